@@ -16,6 +16,7 @@ The coeff_obj.c module encapsulates the parameter data structures
 #include "scenario_obj.h"
 #include "proc_obj.h"
 #include "memory_obj.h"
+#include "utilities.h"
 #include "globals.h"
 
 char coeff_obj_c_sccs_id[] = "@(#)coeff_obj.c	1.84	12/4/00";
@@ -35,6 +36,25 @@ static coeff_int_info stop_coeff;
 static coeff_int_info best_fit_coeff;
 static char coeff_filename[MAX_FILENAME_LEN];
 
+/* bumped whenever a current coefficient takes a new value, so derived */
+/* values (the spread plan) know when to be rebuilt                    */
+static unsigned int current_generation;
+
+/* coefficient file lines coeff_DeferWrites holds back */
+static FILE *deferred_coeff;
+static BOOLEAN deferring_coeff;
+#ifdef _OPENMP
+#pragma omp threadprivate (saved_coefficient, current_coefficient)
+#pragma omp threadprivate (current_generation)
+#pragma omp threadprivate (deferred_coeff, deferring_coeff)
+#endif
+
+/* growth rate and percent urban of each self modification, while a */
+/* trace is set (see coeff_SetTrace)                                  */
+static double *trace;
+static int trace_capacity;
+static int trace_count;
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -42,6 +62,7 @@ static char coeff_filename[MAX_FILENAME_LEN];
 **                                                                           **
 *******************************************************************************
 \*****************************************************************************/
+static void coeff_NoteChange (coeff_val_info * before);
 
 /*****************************************************************************\
 *******************************************************************************
@@ -65,6 +86,9 @@ static char coeff_filename[MAX_FILENAME_LEN];
 void
   coeff_SetCurrentDiffusion (double val)
 {
+  coeff_val_info before;
+
+  before = current_coefficient;
   if (val == 0)
   {
     current_coefficient.diffusion = 1;
@@ -75,6 +99,7 @@ void
     current_coefficient.diffusion = val;
     saved_coefficient.diffusion = val;
   }
+  coeff_NoteChange (&before);
 }
 
 /******************************************************************************
@@ -91,6 +116,9 @@ void
 void
   coeff_SetCurrentSpread (double val)
 {
+  coeff_val_info before;
+
+  before = current_coefficient;
   if (val == 0)
   {
     current_coefficient.spread = 1;
@@ -101,6 +129,7 @@ void
     current_coefficient.spread = val;
     saved_coefficient.spread = val;
   }
+  coeff_NoteChange (&before);
 }
 /******************************************************************************
 *******************************************************************************
@@ -116,6 +145,9 @@ void
 void
   coeff_SetCurrentBreed (double val)
 {
+  coeff_val_info before;
+
+  before = current_coefficient;
   if (val == 0)
   {
     current_coefficient.breed = 1;
@@ -126,6 +158,7 @@ void
     current_coefficient.breed = val;
     saved_coefficient.breed = val;
   }
+  coeff_NoteChange (&before);
 }
 
 /******************************************************************************
@@ -142,6 +175,9 @@ void
 void
   coeff_SetCurrentSlopeResist (double val)
 {
+  coeff_val_info before;
+
+  before = current_coefficient;
   if (val == 0)
   {
     current_coefficient.slope_resistance = 1;
@@ -152,6 +188,7 @@ void
     current_coefficient.slope_resistance = val;
     saved_coefficient.slope_resistance = val;
   }
+  coeff_NoteChange (&before);
 }
 
 /******************************************************************************
@@ -168,6 +205,9 @@ void
 void
   coeff_SetCurrentRoadGravity (double val)
 {
+  coeff_val_info before;
+
+  before = current_coefficient;
   if (val == 0)
   {
     current_coefficient.road_gravity = 1;
@@ -178,6 +218,7 @@ void
     current_coefficient.road_gravity = val;
     saved_coefficient.road_gravity = val;
   }
+  coeff_NoteChange (&before);
 }
 
 /******************************************************************************
@@ -785,6 +826,25 @@ double
   return current_coefficient.road_gravity;
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: coeff_GetCurrentGeneration
+** PURPOSE:       return the generation of current_coefficient
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Changes whenever a coeff_SetCurrent* call or
+**                coeff_SelfModication changes a current coefficient;
+**                setting a coefficient to the value it already has
+**                leaves it alone.
+**
+*/
+unsigned int
+  coeff_GetCurrentGeneration ()
+{
+  return current_generation;
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: coeff_GetStepDiffusion
@@ -1451,7 +1511,14 @@ void
 
   if (scen_GetWriteCoeffFileFlag ())
   {
-    FILE_OPEN (fp, coeff_filename, "a");
+    if (deferring_coeff)
+    {
+      fp = deferred_coeff;
+    }
+    else
+    {
+      FILE_OPEN (fp, coeff_filename, "a");
+    }
 
     fprintf (fp, "%5u %5u %4u %8.2f %8.2f %8.2f %8.2f %8.2f\n",
              proc_GetCurrentRun (),
@@ -1462,7 +1529,47 @@ void
              current_coefficient.spread,
              current_coefficient.slope_resistance,
              current_coefficient.road_gravity);
-    fclose (fp);
+    if (!deferring_coeff)
+    {
+      fclose (fp);
+    }
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: coeff_DeferWrites
+** PURPOSE:       hold back this thread's coefficient file lines, or
+**                write them
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                While deferred, coeff_WriteCurrentCoeff writes to a
+**                temporary file of the calling thread; turning
+**                deferral off appends them to the coefficient file.
+**
+*/
+void
+  coeff_DeferWrites (BOOLEAN defer)                          /* IN     */
+{
+  char func[] = "coeff_DeferWrites";
+  FILE *fp;
+
+  if (defer)
+  {
+    deferred_coeff = util_OpenDeferred (deferred_coeff);
+    deferring_coeff = TRUE;
+  }
+  else if (deferring_coeff)
+  {
+    deferring_coeff = FALSE;
+    if (ftell (deferred_coeff) > 0)
+    {
+      FILE_OPEN (fp, coeff_filename, "a");
+      util_FlushDeferred (deferred_coeff, fp);
+      fclose (fp);
+    }
   }
 }
 /******************************************************************************
@@ -1508,6 +1615,45 @@ void
 *******************************************************************************
 \*****************************************************************************/
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: coeff_SetTrace
+** PURPOSE:       start or stop recording the self modification inputs
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                While buffer is not NULL, each coeff_SelfModication
+**                appends its growth rate and percent urban to buffer,
+**                up to capacity values.
+**
+*/
+void
+  coeff_SetTrace (double *buffer,                            /* IN     */
+                  int capacity)                              /* IN     */
+{
+  trace = buffer;
+  trace_capacity = capacity;
+  trace_count = 0;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: coeff_GetTraceCount
+** PURPOSE:       return the number of values recorded since coeff_SetTrace
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+int
+  coeff_GetTraceCount ()
+{
+  return trace_count;
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: coeff_SelfModication
@@ -1524,7 +1670,36 @@ void
   coeff_SelfModication (double growth_rate, double percent_urban)
 {
   char func[] = "coeff_SelfModication";
+  coeff_val_info before;
+
+  before = current_coefficient;
+  if ((trace != NULL) && (trace_count + 2 <= trace_capacity))
+  {
+    trace[trace_count++] = growth_rate;
+    trace[trace_count++] = percent_urban;
+  }
+  coeff_SelfModify (&current_coefficient, growth_rate, percent_urban);
+  coeff_NoteChange (&before);
+}
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: coeff_SelfModify
+** PURPOSE:       apply self modification to a set of coefficients
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                The body of coeff_SelfModication, for any set of
+**                coefficients, so the driver can replay a run's self
+**                modification for other starting coefficients.
+**
+*/
+void
+  coeff_SelfModify (coeff_val_info * coeff,                  /* IN/OUT */
+                    double growth_rate,                      /* IN     */
+                    double percent_urban)                    /* IN     */
+{
   /*
    *
    * boom year
@@ -1532,39 +1707,39 @@ void
    */
   if (growth_rate > scen_GetCriticalHigh ())
   {
-    current_coefficient.slope_resistance -=
+    coeff->slope_resistance -=
       (double) (percent_urban * scen_GetSlopeSensitivity ());
-    if (current_coefficient.slope_resistance <= MIN_SLOPE_RESISTANCE_VALUE)
+    if (coeff->slope_resistance <= MIN_SLOPE_RESISTANCE_VALUE)
     {
-      current_coefficient.slope_resistance = 1.0;
+      coeff->slope_resistance = 1.0;
     }
 
-    current_coefficient.road_gravity +=
+    coeff->road_gravity +=
       (double) (percent_urban * scen_GetRdGrvtySensitivity ());
-    if (current_coefficient.road_gravity > MAX_ROAD_GRAVITY_VALUE)
+    if (coeff->road_gravity > MAX_ROAD_GRAVITY_VALUE)
     {
-      current_coefficient.road_gravity = MAX_ROAD_GRAVITY_VALUE;
+      coeff->road_gravity = MAX_ROAD_GRAVITY_VALUE;
     }
 
-    if (current_coefficient.diffusion < MAX_DIFFUSION_VALUE)
+    if (coeff->diffusion < MAX_DIFFUSION_VALUE)
     {
-      current_coefficient.diffusion *= scen_GetBoom ();
+      coeff->diffusion *= scen_GetBoom ();
 
-      if (current_coefficient.diffusion > MAX_DIFFUSION_VALUE)
+      if (coeff->diffusion > MAX_DIFFUSION_VALUE)
       {
-        current_coefficient.diffusion = MAX_DIFFUSION_VALUE;
+        coeff->diffusion = MAX_DIFFUSION_VALUE;
       }
 
-      current_coefficient.breed *= scen_GetBoom ();
-      if (current_coefficient.breed > MAX_BREED_VALUE)
+      coeff->breed *= scen_GetBoom ();
+      if (coeff->breed > MAX_BREED_VALUE)
       {
-        current_coefficient.breed = MAX_BREED_VALUE;
+        coeff->breed = MAX_BREED_VALUE;
       }
 
-      current_coefficient.spread *= scen_GetBoom ();
-      if (current_coefficient.spread > MAX_SPREAD_VALUE)
+      coeff->spread *= scen_GetBoom ();
+      if (coeff->spread > MAX_SPREAD_VALUE)
       {
-        current_coefficient.spread = MAX_SPREAD_VALUE;
+        coeff->spread = MAX_SPREAD_VALUE;
       }
     }
   }
@@ -1576,41 +1751,65 @@ void
    */
   if (growth_rate < scen_GetCriticalLow ())
   {
-    current_coefficient.slope_resistance +=
+    coeff->slope_resistance +=
       (double) (percent_urban * scen_GetSlopeSensitivity ());
-    if (current_coefficient.slope_resistance > MAX_SLOPE_RESISTANCE_VALUE)
+    if (coeff->slope_resistance > MAX_SLOPE_RESISTANCE_VALUE)
     {
-      current_coefficient.slope_resistance = MAX_SLOPE_RESISTANCE_VALUE;
+      coeff->slope_resistance = MAX_SLOPE_RESISTANCE_VALUE;
     }
 
-    current_coefficient.road_gravity -=
+    coeff->road_gravity -=
       (double) (percent_urban * scen_GetRdGrvtySensitivity ());
-    if (current_coefficient.road_gravity <= MIN_ROAD_GRAVITY_VALUE)
+    if (coeff->road_gravity <= MIN_ROAD_GRAVITY_VALUE)
     {
-      current_coefficient.road_gravity = 1.0;
+      coeff->road_gravity = 1.0;
     }
 
     if ((growth_rate < scen_GetCriticalLow ()) &&
-        (current_coefficient.diffusion > 0))
+        (coeff->diffusion > 0))
     {
-      current_coefficient.diffusion *= scen_GetBust ();
-      if (current_coefficient.diffusion <= MIN_DIFFUSION_VALUE)
+      coeff->diffusion *= scen_GetBust ();
+      if (coeff->diffusion <= MIN_DIFFUSION_VALUE)
       {
-        current_coefficient.diffusion = 1.0;
+        coeff->diffusion = 1.0;
       }
 
-      current_coefficient.spread *= scen_GetBust ();
-      if (current_coefficient.spread <= MIN_SPREAD_VALUE)
+      coeff->spread *= scen_GetBust ();
+      if (coeff->spread <= MIN_SPREAD_VALUE)
       {
-        current_coefficient.spread = 1.0;
+        coeff->spread = 1.0;
       }
 
-      current_coefficient.breed *= scen_GetBust ();
+      coeff->breed *= scen_GetBust ();
 
-      if (current_coefficient.breed <= MIN_BREED_VALUE)
+      if (coeff->breed <= MIN_BREED_VALUE)
       {
-        current_coefficient.breed = 1.0;
+        coeff->breed = 1.0;
       }
     }
   }
 }
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: coeff_NoteChange
+** PURPOSE:       bump the generation if current_coefficient changed
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   before is current_coefficient as it was on entry to
+**                the caller.
+**
+*/
+static void
+  coeff_NoteChange (coeff_val_info * before)
+{
+  if ((before->diffusion != current_coefficient.diffusion) ||
+      (before->spread != current_coefficient.spread) ||
+      (before->breed != current_coefficient.breed) ||
+      (before->slope_resistance != current_coefficient.slope_resistance) ||
+      (before->road_gravity != current_coefficient.road_gravity))
+  {
+    current_generation++;
+  }
+}
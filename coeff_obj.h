@@ -1,6 +1,7 @@
 #ifndef COEFF_OBJ_H
 #define COEFF_OBJ_H
 #include <stdio.h>
+#include "ugm_defines.h"
 
 typedef struct
 {
@@ -21,6 +22,7 @@ typedef struct
 
 void coeff_MemoryLog(FILE* fp);
 void coeff_WriteCurrentCoeff();
+void coeff_DeferWrites(BOOLEAN defer);
 #if 1
 void coeff_ConcatenateFiles();
 #else
@@ -74,6 +76,7 @@ double coeff_GetCurrentSpread();
 double coeff_GetCurrentBreed();
 double coeff_GetCurrentSlopeResist();
 double coeff_GetCurrentRoadGravity();
+unsigned int coeff_GetCurrentGeneration();
 
 int coeff_GetStepDiffusion();
 int coeff_GetStepSpread();
@@ -108,4 +111,8 @@ void coeff_LogStop(FILE* fp);
 void coeff_LogBestFit(FILE* fp);
 
 void coeff_SelfModication(double growth_rate, double percent_urban);
+void coeff_SelfModify(coeff_val_info* coeff, double growth_rate,
+                      double percent_urban);
+void coeff_SetTrace(double* buffer, int capacity);
+int coeff_GetTraceCount();
 #endif
@@ -47,7 +47,7 @@
 static
   void delta_phase1 (int drive,                              /* IN     */
                      GRID_P urban_land,                      /* IN     */
-                     GRID_P phase1_land,                     /* OUT    */
+                     GRID_P phase1_land,                     /* IN/OUT */
                      GRID_P slope,                           /* IN     */
                      GRID_P deltatron,                       /* IN/OUT */
                      Classes * landuse_classes,              /* IN     */
@@ -61,10 +61,9 @@ static
                              PIXEL local_slope,              /* IN     */
                              CLASS_SLP_TYPE * class_slope); /* IN     */
 static
-  void delta_phase2 (GRID_P urban_land,                      /* IN     */
-                     GRID_P phase1_land,                     /* IN     */
+  void delta_phase2 (GRID_P urban_land,                      /* IN/OUT */
                      GRID_P deltatron,                       /* IN/OUT */
-                     GRID_P phase2_land,                     /* OUT    */
+                     GRID_P phase2_land,                     /* IN/OUT */
                      Classes * landuse_classes,              /* IN     */
                      int *new_indices,                       /* IN     */
                      FTRANS_TYPE * ftransition);           /* IN     */
@@ -86,25 +85,32 @@ char deltatron_c_sccs_id[] = "@(#)deltatron.c	1.372	12/4/00";
 ** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
 ** CREATION DATE: 11/11/1999
 ** DESCRIPTION:
-**
+**                land_mirror must equal urban_land on entry. Phase 1
+**                reads urban_land and transitions pixels of
+**                land_mirror; phase 2 goes on in place in land_mirror.
+**                Every pixel either phase changes has a deltatron of
+**                1, so when the deltatrons are aged only those are
+**                copied back to urban_land, which then holds the new
+**                land and again equals land_mirror. No full grid is
+**                copied. The grids are not swapped: after a swap the
+**                grid that did not take the changes would still need
+**                the same pixels written to keep the two equal, and
+**                the driver holds the land1 pointer across years.
 **
 */
 void
   delta_deltatron (int *new_indices,                         /* IN     */
                    Classes * landuse_classes,                /* IN     */
                    Classes * class_indices,                  /* IN     */
-                   GRID_P workspace1,                        /* MOD    */
+                   GRID_P land_mirror,                       /* MOD    */
                    GRID_P deltatron,                         /* IN/OUT */
-                   GRID_P urban_land,                        /* IN     */
-                   GRID_P land_out,                          /* OUT    */
+                   GRID_P urban_land,                        /* IN/OUT */
                    GRID_P slp,                               /* IN     */
                    int drive,                                /* IN     */
                    CLASS_SLP_TYPE * class_slope,             /* IN     */
                    FTRANS_TYPE * ftransition)              /* IN     */
 {
   char func[] = "DeltaTron";
-  GRID_P phase1_land;
-  GRID_P phase2_land;
 
 
   timer_Start (DELTA_DELTATRON);
@@ -112,19 +118,15 @@ void
   assert (new_indices != NULL);
   assert (landuse_classes != NULL);
   assert (class_indices != NULL);
-  assert (workspace1 != NULL);
+  assert (land_mirror != NULL);
   assert (urban_land != NULL);
-  assert (land_out != NULL);
   assert (slp != NULL);
   assert (class_slope != NULL);
   assert (ftransition != NULL);
 
-  phase1_land = workspace1;
-  phase2_land = land_out;
-
   delta_phase1 (drive,                                       /* IN     */
                 urban_land,                                  /* IN     */
-                phase1_land,                                 /* OUT    */
+                land_mirror,                                 /* IN/OUT */
                 slp,                                         /* IN     */
                 deltatron,                                   /* IN/OUT */
                 landuse_classes,                             /* IN     */
@@ -134,10 +136,9 @@ void
                 ftransition                                  /* IN     */
     );
 
-  delta_phase2 (urban_land,                                  /* IN     */
-                phase1_land,                                 /* IN     */
+  delta_phase2 (urban_land,                                  /* IN/OUT */
                 deltatron,                                   /* IN/OUT */
-                phase2_land,                                 /* OUT    */
+                land_mirror,                                 /* IN/OUT */
                 landuse_classes,                             /* IN     */
                 new_indices,                                 /* IN     */
                 ftransition                                  /* IN     */
@@ -163,7 +164,7 @@ static
   void
   delta_phase1 (int drive,                                   /* IN     */
                 GRID_P urban_land,                           /* IN     */
-                GRID_P phase1_land,                          /* OUT    */
+                GRID_P phase1_land,                          /* IN/OUT */
                 GRID_P slope,                                /* IN     */
                 GRID_P deltatron,                            /* IN/OUT */
                 Classes * landuse_classes,                   /* IN     */
@@ -182,6 +183,8 @@ static
   int j_center;
   PIXEL new_landuse;
   int random_int;
+  int nrows;
+  int ncols;
 
   timer_Start (DELTA_PHASE1);
   FUNC_INIT;
@@ -195,13 +198,14 @@ static
   assert (new_indices != NULL);
   assert (class_slope != NULL);
   assert (ftransition != NULL);
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
 
   /*
    *
-   * COPY INPUT LAND GRID INTO OUTPUT LAND GRID
+   * PHASE1_LAND COMES IN AS A COPY OF THE INPUT LAND GRID
    *
    */
-  util_copy_grid (urban_land, phase1_land);
 
   /*
    *
@@ -275,7 +279,7 @@ static
          *
          */
         util_get_neighbor (i, j, &i, &j);
-        if (IMAGE_PT (i, j))
+        if ((i >= 0) && (i < nrows) && (j >= 0) && (j < ncols))
         {
           /*
            *
@@ -302,7 +306,7 @@ static
              *
              */
             util_get_neighbor (i, j, &i, &j);
-            if (IMAGE_PT (i, j))
+            if ((i >= 0) && (i < nrows) && (j >= 0) && (j < ncols))
             {
               index = new_indices[urban_land[OFFSET (i, j)]];
               if (landuse_classes[index].trans == TRUE)
@@ -406,10 +410,9 @@ static
 */
 static
   void
-  delta_phase2 (GRID_P urban_land,                           /* IN     */
-                GRID_P phase1_land,                          /* IN     */
+  delta_phase2 (GRID_P urban_land,                           /* IN/OUT */
                 GRID_P deltatron,                            /* IN/OUT */
-                GRID_P phase2_land,                          /* OUT    */
+                GRID_P phase2_land,                          /* IN/OUT */
                 Classes * landuse_classes,                   /* IN     */
                 int *new_indices,                            /* IN     */
                 FTRANS_TYPE * ftransition)                 /* IN     */
@@ -430,7 +433,6 @@ static
   timer_Start (DELTA_PHASE2);
   FUNC_INIT;
   assert (urban_land != NULL);
-  assert (phase1_land != NULL);
   assert (deltatron != NULL);
   assert (phase2_land != NULL);
   assert (landuse_classes != NULL);
@@ -439,10 +441,12 @@ static
 
   /*
    *
-   * SAVE CURRENT LAND TO PHASE2_LAND
+   * PHASE2_LAND COMES IN AS THE PHASE 1 LAND AND IS CHANGED IN PLACE.
+   * A PIXEL IS VISITED ONCE AND ONLY IT IS CHANGED THEN, SO IT STILL
+   * HOLDS ITS PHASE 1 VALUE WHEN VISITED; A NEIGHBOR ALREADY CHANGED
+   * HAS A DELTATRON OF 1, NOT 2, SO ITS VALUE IS NEVER USED.
    *
    */
-  util_copy_grid (phase1_land, phase2_land);
 
   /*
    *
@@ -453,7 +457,7 @@ static
   {
     for (j = 1; j < igrid_GetNumCols () - 1; j++)
     {
-      index = new_indices[phase1_land[OFFSET (i, j)]];
+      index = new_indices[phase2_land[OFFSET (i, j)]];
       if ((landuse_classes[index].trans == TRUE) &&
           (deltatron[OFFSET (i, j)] == 0))
       {
@@ -473,7 +477,7 @@ static
           for (k = 0; k < max_num_tries; k++)
           {
             util_get_neighbor (i, j, &i_nghbr, &j_nghbr);
-            index = new_indices[phase1_land[OFFSET (i_nghbr, j_nghbr)]];
+            index = new_indices[phase2_land[OFFSET (i_nghbr, j_nghbr)]];
             if ((deltatron[OFFSET (i_nghbr, j_nghbr)] == 2) &&
                 (landuse_classes[index].trans == TRUE))
             {
@@ -516,13 +520,18 @@ static
 
   /*
    *
-   * AGE THE DELTATRONS
+   * AGE THE DELTATRONS, COPYING THE PIXELS CHANGED THIS YEAR
+   * (DELTATRON == 1) BACK TO URBAN_LAND
    *
    */
   for (i = 0; i < mem_GetTotalPixels (); i++)
   {
     if (deltatron[i] > 0)
     {
+      if (deltatron[i] == 1)
+      {
+        urban_land[i] = phase2_land[i];
+      }
       deltatron[i]++;
     }
   }
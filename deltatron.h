@@ -13,10 +13,9 @@ void
   delta_deltatron (int *new_indices,                               /* IN     */
                    Classes * landuse_classes,                      /* IN     */
                    Classes * class_indices,                        /* IN     */
-                   GRID_P workspace1,                             /* MOD    */
+                   GRID_P land_mirror,                            /* MOD    */
                    GRID_P deltatron,                              /* IN/OUT */
-                   GRID_P urban_land,                             /* IN     */
-                   GRID_P land_out,                               /* OUT    */
+                   GRID_P urban_land,                             /* IN/OUT */
                    GRID_P slp,                                    /* IN     */
                    int drive,                                      /* IN     */
                    CLASS_SLP_TYPE* class_slope,                    /* IN     */
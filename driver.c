@@ -33,6 +33,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "igrid_obj.h"
 #include "pgrid_obj.h"
 #include "landclass_obj.h"
@@ -50,6 +53,8 @@
 #include "stats_obj.h"
 #include "timer_obj.h"
 #include "color_obj.h"
+#include "random.h"
+#include "spread.h"
 
 /*****************************************************************************\
 *******************************************************************************
@@ -60,6 +65,44 @@
 \*****************************************************************************/
 typedef double fmatch_t;
 
+/* a run kept for SKIP_EQUIVALENT_RUNS: its number, coefficients,  */
+/* the growth rate and percent urban of every self modification,   */
+/* and what it wrote to control_stats.log                          */
+typedef struct
+{
+  int run;
+  coeff_val_info start;
+  spr_effective_t effective;
+  double *trace;
+  stats_control_t control;
+} drv_equivalent_t;
+
+/*****************************************************************************\
+*******************************************************************************
+**                                                                           **
+**                                 MACROS                                    **
+**                                                                           **
+*******************************************************************************
+\*****************************************************************************/
+/* bytes of self modification traces SKIP_EQUIVALENT_RUNS may keep */
+#define EQUIVALENT_TRACE_BYTES (64 * 1024 * 1024)
+
+/*****************************************************************************\
+*******************************************************************************
+**                                                                           **
+**                      STATIC MEMORY FOR THIS OBJECT                        **
+**                                                                           **
+*******************************************************************************
+\*****************************************************************************/
+static drv_equivalent_t *equivalent;
+static int equivalent_count;
+static int equivalent_trace_bytes;
+static int equivalent_runs;
+static int equivalent_replicated;
+static coeff_val_info run_start;
+static double *run_trace;
+static int run_trace_size;
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -74,6 +117,33 @@ static
   fmatch_t drv_fmatch (GRID_P cum_probability_ptr,
                        GRID_P landuse1_ptr);
 
+static
+  BOOLEAN drv_equivalence_enabled ();
+
+static
+  BOOLEAN drv_equivalence_replay (drv_equivalent_t * entry,
+                                  coeff_val_info * start);
+
+static
+  void drv_equivalence_store ();
+
+static
+  BOOLEAN drv_parallel_enabled ();
+
+static
+  int drv_monte_carlo_pool (count_grid_t * cumulate,
+                            GRID_P land1_ptr,
+                            int *active,
+                            int ncells);
+
+static
+  void drv_grow_iteration (int imc);
+
+static
+  void drv_merge_iteration (count_grid_t * cumulate,
+                            int *active,
+                            int ncells);
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -214,6 +284,7 @@ void
   }
 
   stats_Analysis (fmatch);
+  drv_equivalence_store ();
 
   /* end of:  if(proc_GetProcessingType() == PREDICTING) */
   timer_Stop (DRV_DRIVER);
@@ -230,6 +301,256 @@ void
 }
 
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_EquivalentRun
+** PURPOSE:       skip a calibration run equivalent to an earlier one
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                SKIP_EQUIVALENT_RUNS. Called for each run, with the
+**                run's coefficients set, in place of drv_driver. If
+**                an earlier run is equivalent (drv_equivalence_replay)
+**                its control statistics are written for this run and
+**                TRUE is returned. Nothing is written to avg.log,
+**                std_dev.log or coeff.log for the run: their
+**                coefficient columns follow this run's own starting
+**                values, which the kept run does not have, so the log
+**                names the run copied from instead. Otherwise a trace is set for the
+**                self modifications of the run, so drv_driver can
+**                keep it, and FALSE is returned.
+**
+*/
+BOOLEAN
+  drv_EquivalentRun ()
+{
+  char func[] = "drv_EquivalentRun";
+  coeff_val_info start;
+  spr_effective_t effective;
+  int nyears;
+  int i;
+
+  FUNC_INIT;
+  if (!drv_equivalence_enabled ())
+  {
+    FUNC_END;
+    return FALSE;
+  }
+  equivalent_runs++;
+
+  start.diffusion = coeff_GetSavedDiffusion ();
+  start.spread = coeff_GetSavedSpread ();
+  start.breed = coeff_GetSavedBreed ();
+  start.slope_resistance = coeff_GetSavedSlopeResist ();
+  start.road_gravity = coeff_GetSavedRoadGravity ();
+  spr_GetEffectiveCoeff (&start, &effective);
+
+  for (i = 0; i < equivalent_count; i++)
+  {
+    if (spr_SameEffectiveCoeff (&equivalent[i].effective, &effective) &&
+        drv_equivalence_replay (&equivalent[i], &start))
+    {
+      stats_ReplicateAnalysis (&equivalent[i].control);
+      equivalent_replicated++;
+      if (scen_GetLogFlag ())
+      {
+        scen_Append2Log ();
+        fprintf (scen_GetLogFP (),
+                 "%s %d run %d copied from equivalent run %d; no avg, std_dev or coeff lines\n",
+                 __FILE__, __LINE__, proc_GetCurrentRun (), equivalent[i].run);
+        scen_CloseLog ();
+      }
+      FUNC_END;
+      return TRUE;
+    }
+  }
+
+  /*
+   *
+   * TRACE THIS RUN IF THERE IS ROOM TO KEEP IT. THE FIRST RUN OF A
+   * PROCESS IS NOT KEPT: IT GROWS WHILE THE ROAD SEARCH STATE OF
+   * SPREAD.C IS STILL BEING BUILT, AND LATER RUNS DO NOT
+   *
+   */
+  nyears = proc_GetStopYear () - igrid_GetUrbanYear (0);
+  run_trace_size = 2 * nyears * scen_GetMonteCarloIterations ();
+  run_trace = NULL;
+  run_start = start;
+  if ((equivalent_runs > 1) && (run_trace_size > 0) &&
+      (equivalent_trace_bytes + run_trace_size * sizeof (double) <=
+       EQUIVALENT_TRACE_BYTES))
+  {
+    run_trace = malloc (run_trace_size * sizeof (double));
+  }
+  coeff_SetTrace (run_trace, (run_trace != NULL) ? run_trace_size : 0);
+  FUNC_END;
+  return FALSE;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_LogEquivalentRuns
+** PURPOSE:       log the number of runs SKIP_EQUIVALENT_RUNS saved
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  drv_LogEquivalentRuns (FILE * fp)                          /* IN     */
+{
+  if (scen_GetSkipEquivalentRunsFlag ())
+  {
+    fprintf (fp, "\n%u of %u calibration runs copied from equivalent runs\n",
+             equivalent_replicated, equivalent_runs);
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_equivalence_enabled
+** PURPOSE:       tell if SKIP_EQUIVALENT_RUNS can prove runs equivalent
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Two runs with equivalent coefficients grow the same
+**                only if they draw the same random numbers. The
+**                legacy engine is seeded again for each calibration
+**                run and so qualifies; the counter streams of
+**                PARALLEL_RANDOM_GROWTH, PARALLEL_ORGANIC_GROWTH and
+**                BIT_SLICED_REPLICAS are keyed by the run and do not.
+**
+*/
+static BOOLEAN
+  drv_equivalence_enabled ()
+{
+  static BOOLEAN noted = FALSE;
+
+  if (!scen_GetSkipEquivalentRunsFlag () ||
+      (proc_GetProcessingType () != CALIBRATING))
+  {
+    return FALSE;
+  }
+  if ((ran_GetEngine () == RANDOM_ENGINE_LEGACY) &&
+      !scen_GetParallelRandomGrowthFlag () &&
+      !scen_GetParallelOrganicGrowthFlag () &&
+      !scen_GetBitSlicedReplicasFlag ())
+  {
+    return TRUE;
+  }
+  if (!noted && scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    fprintf (scen_GetLogFP (),
+             "%s %d SKIP_EQUIVALENT_RUNS needs the legacy random engine; no runs are skipped\n",
+             __FILE__, __LINE__);
+    scen_CloseLog ();
+  }
+  noted = TRUE;
+  return FALSE;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_equivalence_replay
+** PURPOSE:       prove a run equivalent to a kept one
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Replays the self modification of both sets of
+**                coefficients through every year of every Monte Carlo
+**                iteration, from the growth rate and percent urban the
+**                kept run saw. While the effective coefficients agree
+**                the grids agree, so those are the values start would
+**                see too. TRUE if they agree in every year.
+**
+*/
+static BOOLEAN
+  drv_equivalence_replay (drv_equivalent_t * entry,          /* IN     */
+                          coeff_val_info * start)            /* IN     */
+{
+  coeff_val_info a;
+  coeff_val_info b;
+  spr_effective_t effective_a;
+  spr_effective_t effective_b;
+  double *trace;
+  int nyears;
+  int imc;
+  int k;
+
+  nyears = proc_GetStopYear () - igrid_GetUrbanYear (0);
+  trace = entry->trace;
+  for (imc = 0; imc < scen_GetMonteCarloIterations (); imc++)
+  {
+    a = entry->start;
+    b = *start;
+    for (k = 0; k < nyears; k++)
+    {
+      spr_GetEffectiveCoeff (&a, &effective_a);
+      spr_GetEffectiveCoeff (&b, &effective_b);
+      if (!spr_SameEffectiveCoeff (&effective_a, &effective_b))
+      {
+        return FALSE;
+      }
+      coeff_SelfModify (&a, trace[0], trace[1]);
+      coeff_SelfModify (&b, trace[0], trace[1]);
+      trace += 2;
+    }
+  }
+  return TRUE;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_equivalence_store
+** PURPOSE:       keep the run just analysed for SKIP_EQUIVALENT_RUNS
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Kept only if drv_EquivalentRun set a trace and every
+**                self modification of the run is in it.
+**
+*/
+static void
+  drv_equivalence_store ()
+{
+  drv_equivalent_t *more;
+  drv_equivalent_t *entry;
+
+  if (run_trace == NULL)
+  {
+    return;
+  }
+  more = NULL;
+  if (coeff_GetTraceCount () == run_trace_size)
+  {
+    more = realloc (equivalent,
+                    (equivalent_count + 1) * sizeof (drv_equivalent_t));
+  }
+  coeff_SetTrace (NULL, 0);
+  if (more == NULL)
+  {
+    free (run_trace);
+    run_trace = NULL;
+    return;
+  }
+  equivalent = more;
+  entry = &equivalent[equivalent_count++];
+  entry->run = proc_GetCurrentRun ();
+  entry->start = run_start;
+  spr_GetEffectiveCoeff (&entry->start, &entry->effective);
+  entry->trace = run_trace;
+  stats_GetControlStats (&entry->control);
+  equivalent_trace_bytes += run_trace_size * sizeof (double);
+  run_trace = NULL;
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: drv_monte_carlo
@@ -247,116 +568,379 @@ static
 {
   char func[] = "drv_monte_carlo";
   int imc;
-  int i;
   double *class_slope;
   double *ftransition;
-  GRID_P z_ptr;
   int total_pixels;
   int num_monte_carlo;
   int *new_indices;
+  int *active;
+  int ncells;
+  count_grid_t cumulate;
 
   FUNC_INIT;
   class_slope = trans_GetClassSlope ();
   ftransition = trans_GetFTransition ();
-  z_ptr = pgrid_GetZPtr ();
   total_pixels = mem_GetTotalPixels ();
   new_indices = landclass_GetNewIndicesPtr ();
   num_monte_carlo = scen_GetMonteCarloIterations ();
+  active = mem_GetActivePtr ();
+  ncells = (active != NULL) ? mem_GetActiveCount () : total_pixels;
 
   assert (total_pixels > 0);
   assert (land1_ptr != NULL);
-  assert (z_ptr != NULL);
   assert (ftransition != NULL);
   assert (class_slope != NULL);
   assert (new_indices != NULL);
   assert (num_monte_carlo > 0);
 
-  for (imc = 0; imc < scen_GetMonteCarloIterations (); imc++)
+  /*
+   *
+   * BIT_SLICED_REPLICAS GROWS REPLICA_LANES ITERATIONS AT ONCE
+   *
+   */
+  if (scen_GetBitSlicedReplicasFlag () &&
+      (proc_GetProcessingType () == CALIBRATING) &&
+      !scen_GetDoingLanduseFlag ())
   {
-    proc_SetCurrentMonteCarlo (imc);
-
-    /*
-     *
-     * RESET THE PARAMETERS
-     *
-     */
-    coeff_SetCurrentDiffusion (coeff_GetSavedDiffusion ());
-    coeff_SetCurrentSpread (coeff_GetSavedSpread ());
-    coeff_SetCurrentBreed (coeff_GetSavedBreed ());
-    coeff_SetCurrentSlopeResist (coeff_GetSavedSlopeResist ());
-    coeff_SetCurrentRoadGravity (coeff_GetSavedRoadGravity ());
-
-    if (scen_GetLogFlag ())
+    for (imc = 0; imc < num_monte_carlo; imc += REPLICA_LANES)
     {
-      if (scen_GetLogCoeffFlag ())
-      {
-        scen_Append2Log ();
-        coeff_LogCurrent (scen_GetLogFP ());
-        scen_CloseLog ();
-      }
+      grw_grow_replicas (imc, MIN (REPLICA_LANES, num_monte_carlo - imc));
     }
+    FUNC_END;
+    return;
+  }
 
-    /*
-     *
-     * RUN SIMULATION
-     *
-     */
-    stats_InitUrbanizationAttempts ();
-    grw_grow (z_ptr, land1_ptr);
-    if (scen_GetLogFlag ())
-    {
-      if (scen_GetLogUrbanizationAttemptsFlag ())
-      {
-        scen_Append2Log ();
-        stats_LogUrbanizationAttempts (scen_GetLogFP ());
-        scen_CloseLog ();
-      }
-    }
+  /*
+   *
+   * OUTSIDE CALIBRATION, COUNT THE ITERATIONS URBAN AT EACH PIXEL, AND
+   * IN EACH YEAR
+   *
+   */
+  cumulate.c16 = NULL;
+  cumulate.c32 = NULL;
+  if (proc_GetProcessingType () != CALIBRATING)
+  {
+    util_CountGridAlloc (&cumulate, num_monte_carlo, total_pixels);
+    grw_StartYearCounts ();
+  }
 
-    /*
-     *
-     * UPDATE CUMULATE GRID
-     *
-     */
+  /*
+   *
+   * PARALLEL_MONTE_CARLO GROWS ITERATIONS ON A POOL OF THREADS
+   *
+   */
+  imc = 0;
+  if (drv_parallel_enabled ())
+  {
+    imc = drv_monte_carlo_pool (&cumulate, land1_ptr, active, ncells);
+  }
+
+  for (; imc < scen_GetMonteCarloIterations (); imc++)
+  {
+    drv_grow_iteration (imc);
+    drv_merge_iteration (&cumulate, active, ncells);
+  }
+  grw_EndYearCounts ();
+  /*
+   *
+   * NORMALIZE CUMULATIVE URBAN IMAGE
+   *
+   */
 /** D. Donato August 16, 2006 "If" statement added to prevent unnecessary  ***
 ***                           processing during calibration.               **/
-    if (proc_GetProcessingType () != CALIBRATING)
-    {
-    for (i = 0; i < total_pixels; i++)
+  if (proc_GetProcessingType () != CALIBRATING)
+  {
+    util_CountPercent (&cumulate, 0, num_monte_carlo, cumulate_ptr,
+                       total_pixels);
+  }
+  util_CountGridFree (&cumulate);
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_grow_iteration
+** PURPOSE:       grow one Monte Carlo iteration
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                The first half of the body of the drv_monte_carlo
+**                loop, split out so a PARALLEL_MONTE_CARLO thread can
+**                grow iterations on its own grids.
+**
+*/
+static
+  void
+  drv_grow_iteration (int imc)
+{
+  proc_SetCurrentMonteCarlo (imc);
+  ran_SeedMonteCarlo (imc);
+
+  /*
+   *
+   * RESET THE PARAMETERS
+   *
+   */
+  coeff_SetCurrentDiffusion (coeff_GetSavedDiffusion ());
+  coeff_SetCurrentSpread (coeff_GetSavedSpread ());
+  coeff_SetCurrentBreed (coeff_GetSavedBreed ());
+  coeff_SetCurrentSlopeResist (coeff_GetSavedSlopeResist ());
+  coeff_SetCurrentRoadGravity (coeff_GetSavedRoadGravity ());
+
+  if (scen_GetLogFlag ())
+  {
+    if (scen_GetLogCoeffFlag ())
     {
-      if (z_ptr[i] > 0)
-      {
-        cumulate_ptr[i]++;
-      }
-    }
+      scen_Append2Log ();
+      coeff_LogCurrent (scen_GetLogFP ());
+      scen_CloseLog ();
     }
+  }
 
-    /*
-     *
-     * UPDATE ANNUAL LAND CLASS PROBABILITIES
-     *
-     */
-    if (proc_GetProcessingType () == PREDICTING)
+  /*
+   *
+   * RUN SIMULATION
+   *
+   */
+  stats_InitUrbanizationAttempts ();
+  grw_grow (pgrid_GetZPtr (), pgrid_GetLand1Ptr ());
+  if (scen_GetLogFlag ())
+  {
+    if (scen_GetLogUrbanizationAttemptsFlag ())
     {
-      landclass_AnnualProbUpdate (land1_ptr);
+      scen_Append2Log ();
+      stats_LogUrbanizationAttempts (scen_GetLogFP ());
+      scen_CloseLog ();
     }
-
   }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_merge_iteration
+** PURPOSE:       add the iteration just grown to the Monte Carlo totals
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                The second half of the body of the drv_monte_carlo
+**                loop; iterations must be merged in order.
+**
+*/
+static
+  void
+  drv_merge_iteration (count_grid_t * cumulate,
+                       int *active,
+                       int ncells)
+{
+  GRID_P z_ptr;
+
+  z_ptr = pgrid_GetZPtr ();
+
   /*
    *
-   * NORMALIZE CUMULATIVE URBAN IMAGE
+   * UPDATE CUMULATE COUNTS
    *
    */
 /** D. Donato August 16, 2006 "If" statement added to prevent unnecessary  ***
 ***                           processing during calibration.               **/
   if (proc_GetProcessingType () != CALIBRATING)
   {
-  for (i = 0; i < total_pixels; i++)
+  /* z is zero outside the active domain (ACTIVE_DOMAIN) */
+  util_CountUrban (cumulate, 0, z_ptr, active, ncells);
+  }
+
+  /*
+   *
+   * UPDATE ANNUAL LAND CLASS PROBABILITIES
+   *
+   */
+  if (proc_GetProcessingType () == PREDICTING)
   {
-    cumulate_ptr[i] = (100.0 * cumulate_ptr[i]) / num_monte_carlo;
+    landclass_AnnualProbUpdate (pgrid_GetLand1Ptr ());
   }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_parallel_enabled
+** PURPOSE:       tell if PARALLEL_MONTE_CARLO can grow iterations at once
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                An iteration grows the same on any thread only if its
+**                random numbers do not depend on the iterations before
+**                it, which takes the counter engine; the legacy engine
+**                runs one sequence through them all.
+**
+*/
+static BOOLEAN
+  drv_parallel_enabled ()
+{
+  static BOOLEAN noted = FALSE;
+
+  if (!scen_GetParallelMonteCarloFlag ())
+  {
+    return FALSE;
+  }
+#ifdef _OPENMP
+  if (ran_GetEngine () == RANDOM_ENGINE_COUNTER)
+  {
+    return TRUE;
   }
+#endif
+  if (!noted && scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    fprintf (scen_GetLogFP (),
+             "%s %d PARALLEL_MONTE_CARLO needs OpenMP and the counter random engine; iterations run one at a time\n",
+             __FILE__, __LINE__);
+    scen_CloseLog ();
+  }
+  noted = TRUE;
+  return FALSE;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: drv_monte_carlo_pool
+** PURPOSE:       grow the Monte Carlo iterations on a pool of threads
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Each thread grows whole iterations on its own grids,
+**                holding back what they write (see scen_DeferLog,
+**                coeff_DeferWrites and stats_DeferOutput); the
+**                iterations are then merged and written in order, so
+**                the results are those of the serial loop. Returns the
+**                number of iterations done; the caller does the rest.
+**
+**                An iteration that builds a road grid's search
+**                structures grows differently from the ones after it
+**                (see spr_SettleRoads), so if the first one would, it
+**                is grown here, alone, first.
+**
+*/
+static
+  int
+  drv_monte_carlo_pool (count_grid_t * cumulate,
+                        GRID_P land1_ptr,
+                        int *active,
+                        int ncells)
+{
+  int first;
+#ifdef _OPENMP
+  char func[] = "drv_monte_carlo_pool";
+  int first_year;
+  int num_monte_carlo;
+  int num_threads;
+  int imc;
+  double diffusion;
+  double spread;
+  double breed;
+  double slope_resistance;
+  double road_gravity;
+  BOOLEAN last_mc_flag;
+
+  FUNC_INIT;
+  num_monte_carlo = scen_GetMonteCarloIterations ();
+  if (proc_GetProcessingType () == PREDICTING)
+  {
+    first_year = scen_GetPredictionStartDate ();
+  }
+  else
+  {
+    first_year = igrid_GetUrbanYear (0);
+  }
+  first = 0;
+  if (!spr_SettleRoads (first_year, proc_GetStopYear ()))
+  {
+    drv_grow_iteration (0);
+    drv_merge_iteration (cumulate, active, ncells);
+    first = 1;
+    if (!spr_SettleRoads (first_year, proc_GetStopYear ()))
+    {
+      FUNC_END;
+      return first;
+    }
+  }
+
+  num_threads = scen_GetNumThreads ();
+  if (num_threads <= 0)
+  {
+    num_threads = omp_get_max_threads ();
+  }
+  num_threads = MIN (num_threads, num_monte_carlo - first);
+  if (num_threads < 2)
+  {
+    FUNC_END;
+    return first;
+  }
+
+  diffusion = coeff_GetSavedDiffusion ();
+  spread = coeff_GetSavedSpread ();
+  breed = coeff_GetSavedBreed ();
+  slope_resistance = coeff_GetSavedSlopeResist ();
+  road_gravity = coeff_GetSavedRoadGravity ();
+  last_mc_flag = proc_GetLastMonteCarloFlag ();
+  if (proc_GetProcessingType () != CALIBRATING)
+  {
+    grw_StartYearTurns (first);
+  }
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    mem_ThreadInit ();
+    pgrid_ThreadInit ();
+    proc_ThreadInit (last_mc_flag);
+    coeff_SetSavedDiffusion (diffusion);
+    coeff_SetSavedSpread (spread);
+    coeff_SetSavedBreed (breed);
+    coeff_SetSavedSlopeResist (slope_resistance);
+    coeff_SetSavedRoadGravity (road_gravity);
+    scen_DeferLog (TRUE);
+    coeff_DeferWrites (TRUE);
+    stats_DeferOutput (TRUE);
+
+#pragma omp for ordered schedule(dynamic,1)
+    for (imc = first; imc < num_monte_carlo; imc++)
+    {
+      drv_grow_iteration (imc);
+#pragma omp ordered
+      {
+        scen_DeferLog (FALSE);
+        coeff_DeferWrites (FALSE);
+        stats_DeferOutput (FALSE);
+        drv_merge_iteration (cumulate, active, ncells);
+        if ((imc == num_monte_carlo - 1) &&
+            (pgrid_GetLand1Ptr () != land1_ptr))
+        {
+          memcpy (land1_ptr, pgrid_GetLand1Ptr (),
+                  mem_GetTotalPixels () * sizeof (PIXEL));
+        }
+        scen_DeferLog (TRUE);
+        coeff_DeferWrites (TRUE);
+        stats_DeferOutput (TRUE);
+      }
+    }
+
+    scen_DeferLog (FALSE);
+    coeff_DeferWrites (FALSE);
+    stats_DeferOutput (FALSE);
+  }
+
+  grw_EndYearTurns ();
+  proc_SetCurrentMonteCarlo (num_monte_carlo - 1);
+  proc_SetCurrentYear (proc_GetStopYear ());
   FUNC_END;
+  return num_monte_carlo;
+#else
+  first = 0;
+  return first;
+#endif
 }
 
 /******************************************************************************
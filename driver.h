@@ -12,4 +12,10 @@ char driver_h_sccs_id[] = "@(#)driver.h	1.228	12/4/00";
 
 void
   drv_driver ();
+
+BOOLEAN
+  drv_EquivalentRun ();
+
+void
+  drv_LogEquivalentRuns (FILE * fp);                         /* IN     */
 #endif
@@ -123,9 +123,13 @@ void
   }
   /*
    *
-   * OUTPUT THE GIF TO DISK
+   * OUTPUT THE GIF TO DISK; GD'S GIF ENCODER KEEPS ITS STATE IN STATIC
+   * MEMORY, SO PARALLEL_MONTE_CARLO THREADS TAKE TURNS
    *
    */
+#ifdef _OPENMP
+#pragma omp critical (gdif_encoder)
+#endif
   gdImageGif (im_out, fp);
   /*
    *
@@ -248,9 +252,13 @@ void
   }
   /*
    *
-   * OUTPUT THE GIF TO DISK
+   * OUTPUT THE GIF TO DISK; GD'S GIF ENCODER KEEPS ITS STATE IN STATIC
+   * MEMORY, SO PARALLEL_MONTE_CARLO THREADS TAKE TURNS
    *
    */
+#ifdef _OPENMP
+#pragma omp critical (gdif_encoder)
+#endif
   gdImageGif (im_out, fp);
   /*
    *
@@ -32,6 +32,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#include <sched.h>
+#endif
 #include "coeff_obj.h"
 #include "igrid_obj.h"
 #include "pgrid_obj.h"
@@ -64,6 +69,23 @@
 \*****************************************************************************/
 char growth_c_sccs_id[] = "@(#)growth.c	1.629	12/4/00";
 
+/*****************************************************************************\
+*******************************************************************************
+**                                                                           **
+**                      STATIC MEMORY FOR THIS OBJECT                        **
+**                                                                           **
+*******************************************************************************
+\*****************************************************************************/
+/* the monte carlo iteration whose turn it is to write each year's files */
+/* (see grw_StartYearTurns), by year - year_turn_first                   */
+static int *year_turn;
+static int year_turn_first;
+static int year_turn_count;
+/* the Monte Carlo totals of urban z for each year outside calibration */
+/* (see grw_StartYearCounts), a grid per year - year_count_first       */
+static count_grid_t year_count;
+static int year_count_first;
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -76,12 +98,23 @@ static
 
 static
   void grw_landuse_init (GRID_P deltatron_ptr,
-                         GRID_P land1_ptr);
+                         GRID_P land1_ptr,
+                         GRID_P land2_ptr);
 static
   void grw_landuse (
                      GRID_P land1_ptr,
                      int num_growth_pix);
 static void grw_completion_status (FILE * fp);
+static void grw_years (GRID_P z_ptr,                         /* IN/OUT */
+                       GRID_P land1_ptr,                     /* IN/OUT */
+                       GRID_P delta);                        /* MOD    */
+static BOOLEAN grw_pipelined_stats ();
+static void grw_wait_turn ();
+static void grw_end_turn ();
+static void grw_condition_z (GRID_P z_ptr,                   /* IN     */
+                             GRID_P target,                  /* IN/OUT */
+                             GRID_P mirror,                  /* IN/OUT */
+                             int set_value);                 /* IN     */
 
 /******************************************************************************
 *******************************************************************************
@@ -98,33 +131,25 @@ void
   grw_grow (GRID_P z_ptr, GRID_P land1_ptr)
 {
   char func[] = "grw_grow";
-  char gif_filename[MAX_FILENAME_LEN];
-  char date_str[4];
   GRID_P deltatron_ptr;
   GRID_P seed_ptr;
   GRID_P delta;
   int total_pixels;
-  float average_slope;
-  int num_growth_pix = 0;
-  int sng;
-  int sdg;
-  int sdc;
-  int og;
-  int rt;
-  int pop;
   int debugcount;
 /** D. Donato 8/17/2006 Added to deal with cumulative growth                 **/
   int   i, nrows, ncols;
-  short *zgrwth_row;
-  short *zgrwth_col;
+  int   *zgrwth_offset;
   int    zgrwth_count;
 /** D. Donato 8/17/2006 Added to deal with cumulative growth                 **/
+  GRID_P nbrcount;
+  int   *frontier_offset;
+  int    frontier_count;
+  MASK_WORD *zmask;
+  int    wpr;
 /* D.D. 8/18/2006 */
   int   row, col, colindex;
-  short *ExcPixRow;
-  short *ExcPixCol;
-  short *UrbPixRow;
-  short *UrbPixCol;
+  int   *UrbPixRow;
+  int   *UrbPixCol;
 /* D.D. 8/18/2006 */
 
 
@@ -153,16 +178,29 @@ void
   }
 
 /** D. Donato 8/17/2006 Added to deal with cumulative growth                 **/
-  zgrwth_row = (short *)  mem_GetGRZrowptr();
-  zgrwth_col = (short *)  mem_GetGRZcolptr();
+  zgrwth_offset =         mem_GetGRZoffptr();
   zgrwth_count =          mem_GetGRZcount();
 
-  if (zgrwth_count == 0) {util_init_grid (z_ptr, 0);}
+  nbrcount = mem_GetNbrCountPtr();
+  frontier_offset = mem_GetFRNoffptr();
+  frontier_count = 0;
+  zmask = mem_GetZMaskPtr();
+  wpr = MASK_WORDS_PER_ROW (ncols);
+
+  if (zgrwth_count == 0)
+    {
+     util_init_grid (z_ptr, 0);
+     if (nbrcount != NULL) {util_init_grid (nbrcount, 0);}
+    }
   else
     {
      for (i=0; i<zgrwth_count; i++)
      {
-      z_ptr[OFFSET(zgrwth_row[i], zgrwth_col[i])] = 0;
+      row = zgrwth_offset[i] / ncols;
+      col = zgrwth_offset[i] % ncols;
+      z_ptr[zgrwth_offset[i]] = 0;
+      if (nbrcount != NULL) {util_clear_neighbors (nbrcount, row, col);}
+      if (zmask != NULL) {MASK_CLEAR (zmask, wpr, row, col);}
      }
      mem_SetGRZcount(0); zgrwth_count = 0;
     }
@@ -171,7 +209,8 @@ void
   if (scen_GetDoingLanduseFlag ())
   {
     grw_landuse_init (deltatron_ptr,
-                      land1_ptr);
+                      land1_ptr,
+                      pgrid_GetLand2Ptr ());
   }
 
 /** D.D. 8/18/2006 Use the UrbPix  array to condition z_ptr more efficiently. ***
@@ -191,6 +230,7 @@ void
 
   colindex = 0;
   zgrwth_count = 0;
+  stats_ResetGrowthSums ();
   for (row=0; row<nrows; row++)
      {
       if (UrbPixRow[row] > 0)
@@ -200,9 +240,15 @@ void
                if (seed_ptr[OFFSET(row, UrbPixCol[colindex])] > 0)
                   {
                    z_ptr[OFFSET(row, UrbPixCol[colindex])] = PHASE0G;
-                   zgrwth_row[zgrwth_count] = row;
-                   zgrwth_col[zgrwth_count] = UrbPixCol[colindex];
+                   if (nbrcount != NULL) {util_increment_neighbors (nbrcount, row, UrbPixCol[colindex]);}
+                   if (zmask != NULL) {MASK_SET (zmask, wpr, row, UrbPixCol[colindex]);}
+                   zgrwth_offset[zgrwth_count] = OFFSET(row, UrbPixCol[colindex]);
                    zgrwth_count++;
+                   if (frontier_offset != NULL)
+                   {
+                    frontier_offset[frontier_count] = OFFSET(row, UrbPixCol[colindex]);
+                    frontier_count++;
+                   }
                   }
                colindex++;
               }
@@ -211,6 +257,8 @@ void
 
     mem_SetGRZcount(zgrwth_count);
     mem_SetGRZpointer(z_ptr);
+    mem_SetFRNcount(frontier_count);
+    spr_InitEligibleCells(z_ptr);
     seed_ptr = igrid_GridRelease (__FILE__, func, __LINE__, seed_ptr);
 
 /** D.D. 8/18/2006 Use the UrbPix array to condition z_ptr more efficiently. **/
@@ -245,6 +293,65 @@ void
   }
 
 
+  if (grw_pipelined_stats ())
+  {
+#ifdef _OPENMP
+#pragma omp parallel num_threads (2)
+    {
+      if ((omp_get_thread_num () == 0) && (omp_get_num_threads () > 1))
+      {
+        stats_StartPipeline ();
+      }
+#pragma omp barrier
+      if (omp_get_thread_num () == 0)
+      {
+        grw_years (z_ptr, land1_ptr, delta);
+        stats_EndPipeline ();
+      }
+      else
+      {
+        stats_PipelineHelper ();
+      }
+    }
+#endif
+  }
+  else
+  {
+    grw_years (z_ptr, land1_ptr, delta);
+  }
+  delta = mem_GetWGridFree (__FILE__, func, __LINE__, delta);
+
+  timer_Stop (GRW_GROWTH);
+  FUNC_END;
+}
+
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_years
+** PURPOSE:       grow the simulated years
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                The year loop of grw_grow.
+**
+*/
+static void
+  grw_years (GRID_P z_ptr,                                   /* IN/OUT */
+             GRID_P land1_ptr,                               /* IN/OUT */
+             GRID_P delta)                                   /* MOD    */
+{
+  char gif_filename[MAX_FILENAME_LEN];
+  char date_str[4];
+  float average_slope;
+  int num_growth_pix = 0;
+  int sng;
+  int sdg;
+  int sdc;
+  int og;
+  int rt;
+  int pop;
   while (proc_GetCurrentYear () < proc_GetStopYear ())
   {
     /*
@@ -403,7 +510,259 @@ printf("||===>> Count of z_ptr pixels no longer set to PHASE0G : %8d\n", debugco
 
     coeff_WriteCurrentCoeff ();
   }
-  delta = mem_GetWGridFree (__FILE__, func, __LINE__, delta);
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_pipelined_stats
+** PURPOSE:       tell if PIPELINED_STATS can use a helper thread
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Not within PARALLEL_MONTE_CARLO, whose threads do not
+**                start threads of their own.
+**
+*/
+static BOOLEAN
+  grw_pipelined_stats ()
+{
+#ifndef _OPENMP
+  static BOOLEAN noted = FALSE;
+#endif
+
+  if (!scen_GetPipelinedStatsFlag ())
+  {
+    return FALSE;
+  }
+#ifdef _OPENMP
+  return !omp_in_parallel ();
+#else
+  if (!noted && scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    fprintf (scen_GetLogFP (),
+             "%s %d PIPELINED_STATS needs OpenMP; statistics are computed in line\n",
+             __FILE__, __LINE__);
+    scen_CloseLog ();
+  }
+  noted = TRUE;
+  return FALSE;
+#endif
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_grow_replicas
+** PURPOSE:       grow a batch of monte carlo iterations at once
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                BIT_SLICED_REPLICAS. Iterations first_mc to
+**                first_mc + nlanes - 1 are grown together, bit k of
+**                each replica word being iteration first_mc + k, so
+**                the pixel lists, the phase 4 test and the year's
+**                placement are shared by the batch. Each replica keeps
+**                its own coefficients and self modification and
+**                reports its statistics as grw_grow would. Calibration
+**                without land use only; the urbanization attempt
+**                counts and the z growth type images are not kept.
+**
+*/
+void
+  grw_grow_replicas (int first_mc,                           /* IN     */
+                     int nlanes)                             /* IN     */
+{
+  char func[] = "grw_grow_replicas";
+  coeff_val_info coeff[REPLICA_LANES];
+  coeff_val_info saved;
+  stats_val_t values;
+  int num_growth_pix[REPLICA_LANES];
+  int pop[REPLICA_LANES];
+  int edges[REPLICA_LANES];
+  int clusters[REPLICA_LANES];
+  double mean_cluster_size[REPLICA_LANES];
+  double leesalee[REPLICA_LANES];
+  double slope_sum[REPLICA_LANES];
+  double xsum[REPLICA_LANES];
+  double ysum[REPLICA_LANES];
+  int sng[REPLICA_LANES];
+  int sdc[REPLICA_LANES];
+  int og[REPLICA_LANES];
+  int rt[REPLICA_LANES];
+  int lane;
+  int k;
+  int row;
+  int col;
+  int colindex;
+  int offset;
+  int nrows;
+  int zcount;
+  int *zlist;
+  int *UrbPixRow;
+  int *UrbPixCol;
+  MASK_WORD lanes;
+  MASK_WORD *z;
+  GRID_P seed_ptr;
+  GRID_P slp;
+
+  FUNC_INIT;
+  assert ((nlanes > 0) && (nlanes <= REPLICA_LANES));
+  timer_Start (GRW_GROWTH);
+  nrows = igrid_GetNumRows ();
+  z = mem_GetReplicaZPtr ();
+  zlist = mem_GetReplicaZListPtr ();
+  zcount = mem_GetReplicaZCount ();
+  assert (z != NULL);
+  lanes = (nlanes == REPLICA_LANES) ? ~(MASK_WORD) 0 :
+    LANE_BIT (nlanes) - 1;
+
+  /*
+   *
+   * CLEAR THE LAST BATCH AND SEED EVERY REPLICA FROM THE FIRST URBAN GRID
+   *
+   */
+  for (k = 0; k < zcount; k++)
+  {
+    z[zlist[k]] = 0;
+  }
+  zcount = 0;
+
+  seed_ptr = igrid_GetUrbanGridPtr (__FILE__, func, __LINE__, 0);
+  slp = igrid_GetSlopeGridPtr (__FILE__, func, __LINE__);
+  UrbPixRow = igrid_GetUrbPixRowPtr ();
+  UrbPixCol = igrid_GetUrbPixColPtr ();
+  for (lane = 0; lane < nlanes; lane++)
+  {
+    pop[lane] = 0;
+    slope_sum[lane] = 0.0;
+    xsum[lane] = 0.0;
+    ysum[lane] = 0.0;
+  }
+  colindex = 0;
+  for (row = 0; row < nrows; row++)
+  {
+    for (col = 0; col < UrbPixRow[row]; col++)
+    {
+      offset = OFFSET (row, UrbPixCol[colindex]);
+      if (seed_ptr[offset] > 0)
+      {
+        z[offset] = lanes;
+        zlist[zcount++] = offset;
+        for (lane = 0; lane < nlanes; lane++)
+        {
+          pop[lane]++;
+          slope_sum[lane] += slp[offset];
+          xsum[lane] += (double) UrbPixCol[colindex];
+          ysum[lane] += (double) row;
+        }
+      }
+      colindex++;
+    }
+  }
+  mem_SetReplicaZCount (zcount);
+  seed_ptr = igrid_GridRelease (__FILE__, func, __LINE__, seed_ptr);
+  slp = igrid_GridRelease (__FILE__, func, __LINE__, slp);
+
+  /* coeff_SetCurrent* also sets the saved coefficients */
+  saved.diffusion = coeff_GetSavedDiffusion ();
+  saved.spread = coeff_GetSavedSpread ();
+  saved.breed = coeff_GetSavedBreed ();
+  saved.slope_resistance = coeff_GetSavedSlopeResist ();
+  saved.road_gravity = coeff_GetSavedRoadGravity ();
+  for (lane = 0; lane < nlanes; lane++)
+  {
+    coeff[lane] = saved;
+  }
+  proc_SetCurrentYear (igrid_GetUrbanYear (0));
+
+  while (proc_GetCurrentYear () < proc_GetStopYear ())
+  {
+    proc_IncrementCurrentYear ();
+
+    /*
+     *
+     * APPLY THE CELLULAR AUTOMATON RULES FOR THIS YEAR, REPLICA BY REPLICA
+     *
+     */
+    timer_Start (SPREAD_TOTAL_TIME);
+    spr_ReplicaCandidates ();
+    for (lane = 0; lane < nlanes; lane++)
+    {
+      proc_SetCurrentMonteCarlo (first_mc + lane);
+      coeff_SetCurrentDiffusion (coeff[lane].diffusion);
+      coeff_SetCurrentSpread (coeff[lane].spread);
+      coeff_SetCurrentBreed (coeff[lane].breed);
+      coeff_SetCurrentSlopeResist (coeff[lane].slope_resistance);
+      coeff_SetCurrentRoadGravity (coeff[lane].road_gravity);
+      sng[lane] = 0;
+      sdc[lane] = 0;
+      og[lane] = 0;
+      rt[lane] = 0;
+      spr_SpreadReplica (lane, first_mc + lane,
+                         &sng[lane], &sdc[lane], &og[lane], &rt[lane]);
+    }
+    spr_PlaceReplicas (nlanes, num_growth_pix, pop, slope_sum, xsum, ysum);
+    timer_Stop (SPREAD_TOTAL_TIME);
+
+    /*
+     *
+     * DO STATISTICS AND SELF MODIFICATION FOR EACH REPLICA
+     *
+     */
+    for (lane = 0; lane < nlanes; lane++)
+    {
+      edges[lane] = 0;
+      clusters[lane] = 0;
+      mean_cluster_size[lane] = 0.0;
+      leesalee[lane] = 1.0;
+    }
+    if (igrid_TestForUrbanYear (proc_GetCurrentYear ()))
+    {
+      stats_ComputeReplicaStats (nlanes, pop, edges, clusters,
+                                 mean_cluster_size, leesalee);
+    }
+    for (lane = 0; lane < nlanes; lane++)
+    {
+      proc_SetCurrentMonteCarlo (first_mc + lane);
+      coeff_SetCurrentDiffusion (coeff[lane].diffusion);
+      coeff_SetCurrentSpread (coeff[lane].spread);
+      coeff_SetCurrentBreed (coeff[lane].breed);
+      coeff_SetCurrentSlopeResist (coeff[lane].slope_resistance);
+      coeff_SetCurrentRoadGravity (coeff[lane].road_gravity);
+
+      values.area = pop[lane];
+      values.edges = edges[lane];
+      values.clusters = clusters[lane];
+      values.pop = pop[lane];
+      values.xmean = xsum[lane] / pop[lane];
+      values.ymean = ysum[lane] / pop[lane];
+      values.slope = slope_sum[lane] / pop[lane];
+      values.rad = pow ((pop[lane] / PI), 0.5);
+      values.mean_cluster_size = mean_cluster_size[lane];
+      values.leesalee = leesalee[lane];
+      stats_SetSNG (sng[lane]);
+      stats_SetSDG (sdc[lane]);
+      stats_SetOG (og[lane]);
+      stats_SetRT (rt[lane]);
+      stats_SetPOP (pop[lane]);
+      stats_UpdateReplica (num_growth_pix[lane], &values);
+
+      coeff_SelfModication (stats_GetGrowthRate (), stats_GetPercentUrban ());
+      coeff_WriteCurrentCoeff ();
+      coeff[lane].diffusion = coeff_GetCurrentDiffusion ();
+      coeff[lane].spread = coeff_GetCurrentSpread ();
+      coeff[lane].breed = coeff_GetCurrentBreed ();
+      coeff[lane].slope_resistance = coeff_GetCurrentSlopeResist ();
+      coeff[lane].road_gravity = coeff_GetCurrentRoadGravity ();
+    }
+  }
+  coeff_SetCurrentDiffusion (saved.diffusion);
+  coeff_SetCurrentSpread (saved.spread);
+  coeff_SetCurrentBreed (saved.breed);
+  coeff_SetCurrentSlopeResist (saved.slope_resistance);
+  coeff_SetCurrentRoadGravity (saved.road_gravity);
 
   timer_Stop (GRW_GROWTH);
   FUNC_END;
@@ -424,7 +783,8 @@ printf("||===>> Count of z_ptr pixels no longer set to PHASE0G : %8d\n", debugco
 static
   void
   grw_landuse_init (GRID_P deltatron_ptr,                    /* OUT    */
-                    GRID_P land1_ptr)                      /* OUT    */
+                    GRID_P land1_ptr,                        /* OUT    */
+                    GRID_P land2_ptr)                      /* OUT    */
 {
   char func[] = "grw_landuse_init";
   int i;
@@ -438,6 +798,7 @@ static
   total_pixels = mem_GetTotalPixels ();
   assert (deltatron_ptr != NULL);
   assert (land1_ptr != NULL);
+  assert (land2_ptr != NULL);
   assert (total_pixels > 0);
   /*
    *
@@ -451,7 +812,8 @@ static
   /*
    *
    * IF PREDICTING USE LANDUSE 1 AS THE STARTING LANDUSE
-   * ELSE USE LANDUSE 0 AS THE STARTING LANDUSE
+   * ELSE USE LANDUSE 0 AS THE STARTING LANDUSE; LAND2 IS KEPT
+   * EQUAL TO LAND1 BETWEEN YEARS (SEE delta_deltatron)
    *
    */
   if (proc_GetProcessingType () == PREDICTING)
@@ -461,6 +823,7 @@ static
     for (i = 0; i < total_pixels; i++)
     {
       land1_ptr[i] = landuse1_ptr[i];
+      land2_ptr[i] = landuse1_ptr[i];
     }
     landuse1_ptr = igrid_GridRelease (__FILE__, func, __LINE__, landuse1_ptr);
   }
@@ -471,6 +834,7 @@ static
     for (i = 0; i < total_pixels; i++)
     {
       land1_ptr[i] = landuse0_ptr[i];
+      land2_ptr[i] = landuse0_ptr[i];
     }
     landuse0_ptr = igrid_GridRelease (__FILE__, func, __LINE__, landuse0_ptr);
   }
@@ -507,11 +871,8 @@ static
   int *new_indices;
   Classes *landuse_classes;
   Classes *class_indices;
-  GRID_P background_ptr;
-  GRID_P grw_landuse_ws1;
   GRID_P deltatron_ptr;
   GRID_P z_ptr;
-  GRID_P deltatron_workspace1;
   GRID_P slp_ptr;
   GRID_P land2_ptr;
   double *class_slope;
@@ -526,9 +887,6 @@ static
   new_indices = landclass_GetNewIndicesPtr ();
   landuse_classes = landclass_GetClassesPtr ();
   class_indices = landclass_GetReducedClassesPtr ();
-  background_ptr = igrid_GetBackgroundGridPtr (__FILE__, func, __LINE__);
-  grw_landuse_ws1 = mem_GetWGridPtr (__FILE__, func, __LINE__);
-  deltatron_workspace1 = mem_GetWGridPtr (__FILE__, func, __LINE__);
   slp_ptr = igrid_GetSlopeGridPtr (__FILE__, func, __LINE__);
   deltatron_ptr = pgrid_GetDeltatronPtr ();
   z_ptr = pgrid_GetZPtr ();
@@ -542,8 +900,6 @@ static
   assert (new_indices != NULL);
   assert (landuse_classes != NULL);
   assert (class_indices != NULL);
-  assert (grw_landuse_ws1 != NULL);
-  assert (deltatron_workspace1 != NULL);
   assert (deltatron_ptr != NULL);
   assert (land1_ptr != NULL);
   assert (land2_ptr != NULL);
@@ -560,34 +916,30 @@ static
      * PLACE THE NEW URBAN SIMULATION INTO THE LAND USE IMAGE
      *
      */
-    util_condition_gif (mem_GetTotalPixels (),
-                        z_ptr,
-                        GT,
-                        0,
-                        land1_ptr,
-                        urban_code);
+    grw_condition_z (z_ptr,                                  /* IN     */
+                     land1_ptr,                              /* IN/OUT */
+                     land2_ptr,                              /* IN/OUT */
+                     urban_code);                            /* IN     */
 
+    /*
+     *
+     * LAND2 MIRRORS LAND1, SO DELTATRON NEEDS NO WORKSPACE AND
+     * LEAVES THE NEW LAND IN LAND1
+     *
+     */
     delta_deltatron (new_indices,                            /* IN     */
                      landuse_classes,                        /* IN     */
                      class_indices,                          /* IN     */
-                     deltatron_workspace1,                   /* MOD    */
+                     land2_ptr,                              /* MOD    */
                      deltatron_ptr,                          /* IN/OUT */
-                     land1_ptr,                              /* IN     */
-                     land2_ptr,                              /* OUT    */
+                     land1_ptr,                              /* IN/OUT */
                      slp_ptr,                                /* IN     */
                      num_growth_pix,                         /* IN     */
                      class_slope,                            /* IN     */
                      ftransition);                         /* IN     */
-
-    /*
-     *
-     * SWITCH THE OLD AND THE NEW
-     *
-     */
-    util_copy_grid (land2_ptr,
-                    land1_ptr);
   }
 
+  grw_wait_turn ();
   if ((proc_GetProcessingType () == PREDICTING) ||
       (proc_GetProcessingType () == TESTING) &&
       (proc_GetLastMonteCarloFlag ()))
@@ -607,6 +959,7 @@ static
                    date_str,
                    255);
   }
+  grw_end_turn ();
 
   /*
    *
@@ -616,19 +969,11 @@ static
   if (proc_GetCurrentYear () == landuse1_year)
   {
 
-    util_condition_gif (mem_GetTotalPixels (),
-                        z_ptr,
-                        GT,
-                        0,
-                        land1_ptr,
-                        urban_code);
+    grw_condition_z (z_ptr,                                  /* IN     */
+                     land1_ptr,                              /* IN/OUT */
+                     land2_ptr,                              /* IN/OUT */
+                     urban_code);                            /* IN     */
   }
-  background_ptr =
-    igrid_GridRelease (__FILE__, func, __LINE__, background_ptr);
-  grw_landuse_ws1 =
-    mem_GetWGridFree (__FILE__, func, __LINE__, grw_landuse_ws1);
-  deltatron_workspace1 =
-    mem_GetWGridFree (__FILE__, func, __LINE__, deltatron_workspace1);
   slp_ptr = igrid_GridRelease (__FILE__, func, __LINE__, slp_ptr);
   FUNC_END;
 }
@@ -648,76 +993,51 @@ static void
   grw_non_landuse (GRID_P z_ptr)
 {
   char func[] = "grw_non_landuse";
-  char command[2 * MAX_FILENAME_LEN + 20];
   GRID_P workspace1;
-  GRID_P workspace2;
   int num_monte_carlo;
   char name[] = "_urban_";
-  char gif_filename[MAX_FILENAME_LEN];
+  size_t offset;
   GRID_P cumulate_monte_carlo;
-  int i;
+  int *active;
+  int ncells;
+  int total_pixels;
 
   FUNC_INIT;
-  workspace1 = mem_GetWGridPtr (__FILE__, func, __LINE__);
-  workspace2 = mem_GetWGridPtr (__FILE__, func, __LINE__);
   num_monte_carlo = scen_GetMonteCarloIterations ();
+  active = mem_GetActivePtr ();
+  total_pixels = mem_GetTotalPixels ();
+  ncells = (active != NULL) ? mem_GetActiveCount () : total_pixels;
 
-  assert (workspace1 != NULL);
-  assert (workspace2 != NULL);
   assert (z_ptr != NULL);
 
 
-  cumulate_monte_carlo = workspace1;
-
   if (proc_GetProcessingType () != CALIBRATING)
   {
-    if (proc_GetCurrentMonteCarlo () == 0)
-    {
-      /*
-       *
-       * ZERO OUT THE ACCUMULATION GRID
-       *
-       */
-
-      util_init_grid (cumulate_monte_carlo, 0);
-    }
-    else
-    {
-      /*
-       *
-       * READ IN THE ACCUMULATION GRID
-       *
-       */
-      sprintf (gif_filename, "%scumulate_monte_carlo.year_%u",
-               scen_GetOutputDir (), proc_GetCurrentYear ());
-      inp_slurp (gif_filename,                               /* IN    */
-                 cumulate_monte_carlo,                       /* OUT   */
-                 memGetBytesPerGridRound ());              /* IN    */
-    }
+    grw_wait_turn ();
+    offset = (size_t) (proc_GetCurrentYear () - year_count_first) *
+      total_pixels;
     /*
      *
-     * ACCUMULATE Z OVER MONTE CARLOS
+     * ACCUMULATE Z OVER MONTE CARLOS IN THIS YEAR'S COUNTS; Z IS ZERO
+     * OUTSIDE THE ACTIVE DOMAIN
      *
      */
-    for (i = 0; i < mem_GetTotalPixels (); i++)
-    {
-      if (z_ptr[i] > 0)
-      {
-        cumulate_monte_carlo[i]++;
-      }
-    }
+    util_CountUrban (&year_count, offset, z_ptr, active, ncells);
 
 
     if (proc_GetCurrentMonteCarlo () == num_monte_carlo - 1)
     {
+      workspace1 = mem_GetWGridPtr (__FILE__, func, __LINE__);
+      assert (workspace1 != NULL);
+      cumulate_monte_carlo = workspace1;
       if (proc_GetProcessingType () == TESTING)
       {
-        util_condition_gif (mem_GetTotalPixels (),           /* IN     */
-                            z_ptr,                           /* IN     */
-                            GT,                              /* IN     */
-                            0,                               /* IN     */
-                            cumulate_monte_carlo,            /* IN/OUT */
-                            100);                          /* IN     */
+        util_CountCopy (&year_count, offset, cumulate_monte_carlo,
+                        total_pixels);
+        grw_condition_z (z_ptr,                              /* IN     */
+                         cumulate_monte_carlo,               /* IN/OUT */
+                         NULL,                               /* IN/OUT */
+                         100);                               /* IN     */
       }
       else
       {
@@ -727,37 +1047,198 @@ static void
          * NORMALIZE ACCULUMLATED GRID
          *
          */
-        for (i = 0; i < mem_GetTotalPixels (); i++)
-        {
-          cumulate_monte_carlo[i] =
-            100 * cumulate_monte_carlo[i] / num_monte_carlo;
-        }
+        util_CountPercent (&year_count, offset, num_monte_carlo,
+                           cumulate_monte_carlo, total_pixels);
       }
       util_WriteZProbGrid (cumulate_monte_carlo, name);
-      if (proc_GetCurrentMonteCarlo () != 0)
-      {
-        sprintf (command, "rm %s", gif_filename);
-        system (command);
-      }
+      workspace1 = mem_GetWGridFree (__FILE__, func, __LINE__, workspace1);
     }
-    else
+    grw_end_turn ();
+  }
+
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_StartYearTurns
+** PURPOSE:       make the iterations of a PARALLEL_MONTE_CARLO pool write
+**                each year's files in turn
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Outside calibration each iteration adds to the counts
+**                of each year, and land use writes a GIF per year, so
+**                iteration first_mc goes first and each
+**                iteration after it waits for the one before to be
+**                done with the year. grw_EndYearTurns goes back to
+**                writing them at once.
+**
+*/
+void
+  grw_StartYearTurns (int first_mc)                          /* IN     */
+{
+  char func[] = "grw_StartYearTurns";
+  int i;
+
+  if (proc_GetProcessingType () == PREDICTING)
+  {
+    year_turn_first = scen_GetPredictionStartDate ();
+  }
+  else
+  {
+    year_turn_first = igrid_GetUrbanYear (0);
+  }
+  year_turn_count = proc_GetStopYear () - year_turn_first + 1;
+  year_turn = (int *) malloc (year_turn_count * sizeof (int));
+  if (year_turn == NULL)
+  {
+    sprintf (msg_buf, "Unable to allocate %lu bytes of memory (year turns)",
+             (unsigned long) (year_turn_count * sizeof (int)));
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  for (i = 0; i < year_turn_count; i++)
+  {
+    year_turn[i] = first_mc;
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_EndYearTurns
+** PURPOSE:       stop taking turns at each year's files
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  grw_EndYearTurns ()
+{
+  free (year_turn);
+  year_turn = NULL;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_StartYearCounts
+** PURPOSE:       set up the per year Monte Carlo counts of urban z
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                grw_non_landuse adds each iteration's z to a count
+**                grid for the year and writes the probability grid on
+**                the last iteration. The counts were once kept in
+**                cumulate_monte_carlo.year_* files, read and rewritten
+**                every year of every iteration.
+**
+*/
+void
+  grw_StartYearCounts ()
+{
+
+  if (proc_GetProcessingType () == PREDICTING)
+  {
+    year_count_first = scen_GetPredictionStartDate ();
+  }
+  else
+  {
+    year_count_first = igrid_GetUrbanYear (0);
+  }
+  util_CountGridAlloc (&year_count,
+                       scen_GetMonteCarloIterations (),
+                       (size_t) (proc_GetStopYear () - year_count_first + 1) *
+                       mem_GetTotalPixels ());
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_EndYearCounts
+** PURPOSE:       free the per year Monte Carlo counts
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  grw_EndYearCounts ()
+{
+  util_CountGridFree (&year_count);
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_wait_turn
+** PURPOSE:       wait until the current iteration may write this year's
+**                files
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The iteration before is always running or done, so
+**                the wait ends. Returns at once unless
+**                grw_StartYearTurns was called.
+**
+*/
+static void
+  grw_wait_turn ()
+{
+#ifdef _OPENMP
+  int index;
+  int turn;
+
+  if (year_turn == NULL)
+  {
+    return;
+  }
+  index = proc_GetCurrentYear () - year_turn_first;
+  for (;;)
+  {
+#pragma omp atomic read
+    turn = year_turn[index];
+    if (turn == proc_GetCurrentMonteCarlo ())
     {
-      /*
-       *
-       * DUMP ACCULUMLATED GRID TO DISK
-       *
-       */
-      sprintf (gif_filename, "%scumulate_monte_carlo.year_%u",
-               scen_GetOutputDir (), proc_GetCurrentYear ());
-      out_dump (gif_filename,
-                cumulate_monte_carlo,
-                memGetBytesPerGridRound ());
+      break;
     }
+    sched_yield ();
   }
+#pragma omp flush
+#endif
+}
 
-  workspace1 = mem_GetWGridFree (__FILE__, func, __LINE__, workspace1);
-  workspace2 = mem_GetWGridFree (__FILE__, func, __LINE__, workspace2);
-  FUNC_END;
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_end_turn
+** PURPOSE:       pass this year's files on to the next iteration
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+static void
+  grw_end_turn ()
+{
+#ifdef _OPENMP
+  int index;
+
+  if (year_turn == NULL)
+  {
+    return;
+  }
+  index = proc_GetCurrentYear () - year_turn_first;
+#pragma omp flush
+#pragma omp atomic write
+  year_turn[index] = proc_GetCurrentMonteCarlo () + 1;
+#endif
 }
 
 /******************************************************************************
@@ -836,3 +1317,53 @@ static void
     fprintf (fp, "\n");
   }
 }
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: grw_condition_z
+** PURPOSE:       set target to set_value wherever z is urban
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   util_condition_gif with GT 0, visiting only the active
+**                domain when there is one (ACTIVE_DOMAIN), since z is
+**                zero outside it. A mirror grid, if not NULL, is set
+**                the same in the one pass.
+**
+*/
+static void
+  grw_condition_z (GRID_P z_ptr,                             /* IN     */
+                   GRID_P target,                            /* IN/OUT */
+                   GRID_P mirror,                            /* IN/OUT */
+                   int set_value)                            /* IN     */
+{
+  int *active;
+  int count;
+  int i;
+  int k;
+
+  active = mem_GetActivePtr ();
+  if ((active == NULL) && (mirror == NULL))
+  {
+    util_condition_gif (mem_GetTotalPixels (),               /* IN     */
+                        z_ptr,                               /* IN     */
+                        GT,                                  /* IN     */
+                        0,                                   /* IN     */
+                        target,                              /* IN/OUT */
+                        set_value);                          /* IN     */
+    return;
+  }
+  count = (active != NULL) ? mem_GetActiveCount () : mem_GetTotalPixels ();
+  for (k = 0; k < count; k++)
+  {
+    i = (active != NULL) ? active[k] : k;
+    if (z_ptr[i] > 0)
+    {
+      target[i] = set_value;
+      if (mirror != NULL)
+      {
+        mirror[i] = set_value;
+      }
+    }
+  }
+}
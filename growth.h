@@ -20,6 +20,11 @@ char growth_h_sccs_id[] = "@(#)growth.h	1.245	12/4/00";
  *
  */
 void grw_grow(GRID_P z_ptr, GRID_P land1_ptr);
+void grw_grow_replicas(int first_mc, int nlanes);
+void grw_StartYearTurns(int first_mc);
+void grw_EndYearTurns();
+void grw_StartYearCounts();
+void grw_EndYearCounts();
 void Growth (int stop_date,
              Classes* landuse_classes,
              Classes* class_indices,
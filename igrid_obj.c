@@ -53,6 +53,7 @@ This object encapsulates the management of the input data grids.
 #include "landclass_obj.h"
 #include "ugm_macros.h"
 #include "proc_obj.h"
+#include "stats_obj.h"
 
 /*****************************************************************************\
 *******************************************************************************
@@ -76,8 +77,8 @@ static int road_pixel_count[MAX_ROAD_YEARS];
 static int excld_count;
 static road_percent_t percent_road[MAX_ROAD_YEARS];
 static int total_pixels;
-static short *ExcPixRow, *ExcPixCol;
-static short *UrbPixRow, *UrbPixCol;
+static int   *ExcPixRow, *ExcPixCol;
+static int   *UrbPixRow, *UrbPixCol;
 static GRID_P epix;
 static GRID_P upix;
 
@@ -1160,6 +1161,7 @@ void
     grid_SetMinMax (&igrid.urban[i]);
     grid_histogram (&igrid.urban[i]);
   }
+  stats_ClearUrbanMasks ();
 
   for (i = 0; i < igrid.road_count; i++)
   {
@@ -1888,14 +1890,14 @@ int
 {
  char func[] = "igrid_BuildCompactExcPixFile";
  int   length, i, j, k;
- short nrows, ncols;
+ int   nrows, ncols;
 
  nrows = igrid_GetNumRows();
  ncols = igrid_GetNumCols();
  length = igrid_GetIGridExcludedPixelCount();
  if (length < 200) length = 200000;
- ExcPixRow = malloc( (nrows+2) * sizeof(short));
- ExcPixCol = malloc( (length+2) * sizeof(short));
+ ExcPixRow = malloc( (nrows+2) * sizeof(int));
+ ExcPixCol = malloc( (length+2) * sizeof(int));
 
   if ( (ExcPixRow == NULL) || (ExcPixCol == NULL) )
   {
@@ -1939,7 +1941,7 @@ int
 {
  char func[] = "igrid_BuildCompactUrbPixFile";
  int   length, i, j, k;
- short nrows, ncols;
+ int   nrows, ncols;
 
  nrows = igrid_GetNumRows();
  ncols = igrid_GetNumCols();
@@ -1948,8 +1950,8 @@ int
  for (i=1; i<256; i++) {length+=igrid.urban[0].histogram[i];}
  if (length < 200) length = 200000;
 
- UrbPixRow = malloc( (nrows+2) * sizeof(short));
- UrbPixCol = malloc( (length+2) * sizeof(short));
+ UrbPixRow = malloc( (nrows+2) * sizeof(int));
+ UrbPixCol = malloc( (length+2) * sizeof(int));
 
  upix = igrid_GetUrbanGridPtr (__FILE__, func, __LINE__, 0);
 
@@ -1981,7 +1983,7 @@ int
 **                
 **                
 */
-short*
+int*
   igrid_GetExcPixRowPtr()
 {
   return ExcPixRow ;
@@ -1998,7 +2000,7 @@ short*
 **                
 **                
 */
-short*
+int*
   igrid_GetExcPixColPtr()
 {
   return ExcPixCol ;
@@ -2015,7 +2017,7 @@ short*
 **                
 **                
 */
-short*
+int*
   igrid_GetUrbPixRowPtr()
 {
   return UrbPixRow ;
@@ -2032,7 +2034,7 @@ short*
 **                
 **                
 */
-short*
+int*
   igrid_GetUrbPixColPtr()
 {
   return UrbPixCol ;
@@ -2054,3 +2056,96 @@ GRID_P
 {
   return upix ;
 }
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: igrid_BuildActiveDomain
+** PURPOSE:       Index the pixels the simulation can make urban.
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Does nothing unless ACTIVE_DOMAIN(YES/NO)=YES. A pixel
+**                is active if it is not excluded (value below 100) or is
+**                urban in any urban input grid; growth is only placed on
+**                the first, and Z is seeded from the second, so Z and
+**                the grids accumulated from it are zero everywhere else.
+**                The pixels are marked in a working grid, which is
+**                released once the list and its bounding window are
+**                built.
+**
+*/
+void
+  igrid_BuildActiveDomain(void)
+{
+  char func[] = "igrid_BuildActiveDomain";
+  int *active;
+  int count;
+  int i;
+  int k;
+  int row;
+  int col;
+  int first_row;
+  int last_row;
+  int first_col;
+  int last_col;
+  GRID_P mark;
+  GRID_P excld;
+  GRID_P urban;
+
+  active = mem_GetActivePtr ();
+  if (active == NULL) return;
+
+  mark = mem_GetWGridPtr (__FILE__, func, __LINE__);
+  excld = igrid_GetExcludedGridPtr (__FILE__, func, __LINE__);
+  for (i = 0; i < total_pixels; i++)
+  {
+    mark[i] = (excld[i] < 100) ? 1 : 0;
+  }
+  excld = igrid_GridRelease (__FILE__, func, __LINE__, excld);
+
+  for (k = 0; k < igrid_GetUrbanCount (); k++)
+  {
+    urban = igrid_GetUrbanGridPtr (__FILE__, func, __LINE__, k);
+    for (i = 0; i < total_pixels; i++)
+    {
+      if (urban[i] > 0) mark[i] = 1;
+    }
+    urban = igrid_GridRelease (__FILE__, func, __LINE__, urban);
+  }
+
+  count = 0;
+  first_row = igrid_GetNumRows ();
+  last_row = -1;
+  first_col = igrid_GetNumCols ();
+  last_col = -1;
+  for (i = 0; i < total_pixels; i++)
+  {
+    if (mark[i] == 0) continue;
+    active[count++] = i;
+    row = i / igrid_GetNumCols ();
+    col = i % igrid_GetNumCols ();
+    first_row = MIN (first_row, row);
+    last_row = MAX (last_row, row);
+    first_col = MIN (first_col, col);
+    last_col = MAX (last_col, col);
+  }
+  mem_SetActiveCount (count);
+  if (count > 0)
+  {
+    mem_SetActiveWindow (first_row, last_row, first_col, last_col);
+  }
+  mark = mem_GetWGridFree (__FILE__, func, __LINE__, mark);
+
+  if (scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    fprintf (scen_GetLogFP (), "%s %d Active domain: %d of %d pixels\n",
+             __FILE__, __LINE__, count, total_pixels);
+    if (count > 0)
+    {
+      fprintf (scen_GetLogFP (), "%s %d Active window: rows %d to %d, cols %d to %d\n",
+               __FILE__, __LINE__, first_row, last_row, first_col, last_col);
+    }
+    scen_CloseLog ();
+  }
+}
@@ -82,12 +82,13 @@ int  igrid_GetIGridRoadPixelCountByIndex (int i);
 int  igrid_BuildCompactExcPixFile(void);
 int  igrid_BuildCompactUrbPixFile(void);
 /* D.D. Added August 16, 2006 */
+void igrid_BuildActiveDomain(void);
 
 /* D.D. Added August 18, 2006 */
-short* igrid_GetExcPixRowPtr();
-short* igrid_GetExcPixColPtr();
-short* igrid_GetUrbPixRowPtr();
-short* igrid_GetUrbPixColPtr();
+int*   igrid_GetExcPixRowPtr();
+int*   igrid_GetExcPixColPtr();
+int*   igrid_GetUrbPixRowPtr();
+int*   igrid_GetUrbPixColPtr();
 GRID_P igrid_GetUrbPixPointer();
 
 /* D.D. Added August 18, 2006 */
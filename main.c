@@ -17,6 +17,8 @@
      This module contains the main (entry) routine for the SLEUTH model
      along with an error-handling function and a function for
      removing limits on the stack size when running the model.
+     The model itself is loaded and run through libsleuth.a
+     (sleuth.c).
 
   NOTES:
 
@@ -80,7 +82,6 @@
 
 **************************************************************************/
 
-#define MAIN_MODULE
 #define MAIN
 #ifdef MPI
 #include <mpi.h>
@@ -120,6 +121,7 @@
 #include "stats_obj.h"
 #include "transition_obj.h"
 #include "ugm_macros.h"
+#include "sleuth.h"
 
 /*****************************************************************************\
 *******************************************************************************
@@ -177,49 +179,18 @@ char main_c_sccs_id[] = "@(#)main.c	1.629	12/4/00";
 **
 */
 
-/*VerD*/
-
-FILE *fpVerD2;
-FILE *fpVerD3;
-FILE *fpVerD4;
-
-double aux_diffusion_coeff  = - 1.0f;
-double aux_breed_coeff      = - 1.0f;
-double aux_diffusion_mult   = 0.005f;
-
-BOOLEAN WriteSlopeFileFlag    = 0;
-BOOLEAN WriteRatioFileFlag    = 0;
-BOOLEAN WriteXypointsFileFlag = 0;
-
-/*VerD*/
-
-/* Variable added for load balancing - D. Donato - 6/5/2006 */
-
-int redistributedloadcount=0;
-
-/* Variable added for load balancing - D. Donato - 6/5/2006 */
-
 int
   main (int argc, char *argv[])
 {
   char func[] = "main";
-  char fname[MAX_FILENAME_LEN];
   char command[5 * MAX_FILENAME_LEN];
-  int restart_run = 0;
-  RANDOM_SEED_TYPE random_seed;
+  int processing_type;
+  BOOLEAN restart = FALSE;
   int diffusion_coeff;
   int breed_coeff;
   int spread_coeff;
   int slope_resistance;
   int road_gravity;
-  int restart_diffusion;
-  int restart_breed;
-  int restart_spread;
-  int restart_slope_resistance;
-  int restart_road_gravity;
-  time_t tp;
-  char processing_str[MAX_FILENAME_LEN];
-  int i;
 
 /* Added 6/20/2006 by D. Donato to prevent aborts due to stack overflow. */
 
@@ -246,14 +217,8 @@ int
   MPI_Init (&argc, &argv);
   MPI_Comm_rank (MPI_COMM_WORLD, &glb_mype);
   MPI_Comm_size (MPI_COMM_WORLD, &glb_npes);
-#else
-  glb_mype = 0;
-  glb_npes = 1;
 #endif
 
-  timer_Init ();
-  timer_Start (TOTAL_TIME);
-
   glb_call_stack_index = -1;
   FUNC_INIT;
 
@@ -275,418 +240,33 @@ int
   }
   if (strcmp (argv[1], "predict") == 0)
   {
-    proc_SetProcessingType (PREDICTING);
-    strcpy (processing_str, "PREDICTING");
+    processing_type = PREDICTING;
   }
   if (strcmp (argv[1], "restart") == 0)
   {
-    proc_SetProcessingType (CALIBRATING);
-    proc_SetRestartFlag (TRUE);
-    strcpy (processing_str, "restart CALIBRATING");
+    processing_type = CALIBRATING;
+    restart = TRUE;
   }
   if (strcmp (argv[1], "test") == 0)
   {
-    proc_SetProcessingType (TESTING);
-    strcpy (processing_str, "TESTING");
+    processing_type = TESTING;
   }
   if (strcmp (argv[1], "calibrate") == 0)
   {
-    proc_SetProcessingType (CALIBRATING);
-    strcpy (processing_str, "CALIBRATING");
-  }
-  scen_init (argv[2]);
-
-  /*
-   *
-   * SET SOME VARIABLES
-   *
-   */
-  random_seed = scen_GetRandomSeed ();
-
-/*
- * void landclassSetGrayscale (int index, int val);
- * void landclassSetColor (int index, int val);
- * void landclassSetType (int index, char* string);
- * void landclassSetName (int index, char* string);
- * void landclassSetNumClasses (int val);
- * int scen_GetNumLanduseClasses ();
- * char* scen_GetLanduseClassName (int);
- * char* scen_GetLanduseClassType (int);
- * int scen_GetLanduseClassColor (int);
- * int scen_GetLanduseClassGrayscale (int i);
- * 
- */
-  landclassSetNumClasses (scen_GetNumLanduseClasses ());
-  for (i = 0; i < scen_GetNumLanduseClasses (); i++)
-  {
-    landclassSetGrayscale (i, scen_GetLanduseClassGrayscale (i));
-    landclassSetName (i, scen_GetLanduseClassName (i));
-    landclassSetType (i, scen_GetLanduseClassType (i));
-    landclassSetColor (i, scen_GetLanduseClassColor (i));
-  }
-
-  /*
-   *
-   * SET UP COEFFICIENTS
-   *
-   */
-  if (strcmp (argv[1], "restart") == 0)
-  {
-    if (scen_GetLogFlag ())
-    {
-      scen_Append2Log ();
-      if (scen_GetLogFP ())
-      {
-        fprintf (scen_GetLogFP (), "%s %u Reading restart file\n",
-                 __FILE__, __LINE__);
-      }
-      scen_CloseLog ();
-    }
-    inp_read_restart_file (&restart_diffusion,
-                           &restart_breed,
-                           &restart_spread,
-                           &restart_slope_resistance,
-                           &restart_road_gravity,
-                           &random_seed,
-                           &restart_run);
-    proc_SetCurrentRun (restart_run);
-
-  }
-  else
-  {
-    proc_SetCurrentRun (0);
+    processing_type = CALIBRATING;
   }
-  coeff_SetStartDiffusion (scen_GetCoeffDiffusionStart ());
-  coeff_SetStartSpread (scen_GetCoeffSpreadStart ());
-  coeff_SetStartBreed (scen_GetCoeffBreedStart ());
-  coeff_SetStartSlopeResist (scen_GetCoeffSlopeResistStart ());
-  coeff_SetStartRoadGravity (scen_GetCoeffRoadGravityStart ());
-
-  coeff_SetStopDiffusion (scen_GetCoeffDiffusionStop ());
-  coeff_SetStopSpread (scen_GetCoeffSpreadStop ());
-  coeff_SetStopBreed (scen_GetCoeffBreedStop ());
-  coeff_SetStopSlopeResist (scen_GetCoeffSlopeResistStop ());
-  coeff_SetStopRoadGravity (scen_GetCoeffRoadGravityStop ());
-
-  coeff_SetStepDiffusion (scen_GetCoeffDiffusionStep ());
-  coeff_SetStepSpread (scen_GetCoeffSpreadStep ());
-  coeff_SetStepBreed (scen_GetCoeffBreedStep ());
-  coeff_SetStepSlopeResist (scen_GetCoeffSlopeResistStep ());
-  coeff_SetStepRoadGravity (scen_GetCoeffRoadGravityStep ());
-
-  coeff_SetBestFitDiffusion (scen_GetCoeffDiffusionBestFit ());
-  coeff_SetBestFitSpread (scen_GetCoeffSpreadBestFit ());
-  coeff_SetBestFitBreed (scen_GetCoeffBreedBestFit ());
-  coeff_SetBestFitSlopeResist (scen_GetCoeffSlopeResistBestFit ());
-  coeff_SetBestFitRoadGravity (scen_GetCoeffRoadGravityBestFit ());
-
-  /*
-   *
-   * INITIALIZE IGRID
-   *
-   */
-  igrid_init ();
 
   /*
    *
-   * PRINT BANNER
+   * LOAD THE SCENARIO AND ITS INPUTS
    *
    */
-  if (scen_GetEchoFlag ())
-  {
-    out_banner (stdout);
-
-    /*VerD*/
-	fprintf(stdout,
-		"\n\nRunning SLEUTH-3r [August 31, 2006]\n\n");
-    /*VerD*/
-
-  }
-
+  sleuth_Load (processing_type, restart, argv[2]);
   if (scen_GetLogFlag ())
   {
-    scen_Append2Log ();
-    out_banner (scen_GetLogFP ());
-
-	/*VerD*/
-    fprintf(scen_GetLogFP (),
-		"\n\nRunning SLEUTH TEST VERSION 3.0(Rev. D-2.0) [August 31, 2006]\n\n");
-    /*VerD*/
-
-    scen_CloseLog ();
-  }
-
-  /*
-   *
-   * LOG SOME STUFF
-   *
-   */
-  if (scen_GetLogFlag ())
-  {
-    scen_Append2Log ();
-    time (&tp);
-    fprintf (scen_GetLogFP (), "DATE OF RUN: %s\n",
-             asctime (localtime (&tp)));
-
-	/*VerD*/
-
-    if (proc_GetProcessingType () != PREDICTING)
-	{
-		if (WriteXypointsFileFlag == 1)
-		{
-			sprintf(fname,"%sxypoints_pe_%u.log",scen_GetOutputDir(), glb_mype);
-			fpVerD2 =fopen(fname, "w");
-			fprintf(fpVerD2," %%run      mc  diff breed spread slope road_grav year  area\n");
-		}
-
-		if (WriteSlopeFileFlag == 1)
-		{
-			sprintf(fname,"%sslope_pe_%u.log",scen_GetOutputDir(), glb_mype);
-			fpVerD3 =fopen(fname, "w");
-		}
-
-		if (WriteRatioFileFlag == 1)
-		{
-			sprintf(fname,"%sratio_pe_%u.log",scen_GetOutputDir(), glb_mype);
-			fpVerD4 =fopen(fname, "w");
-		}
-	}
-
-	/*VerD*/
-
-
-    fprintf (scen_GetLogFP (), "USER: %s\n", getenv ("USER"));
-    fprintf (scen_GetLogFP (), "HOST: %s\n", getenv ("HOST"));
-    fprintf (scen_GetLogFP (), "HOSTTYPE: %s\n", getenv ("HOSTTYPE"));
-    fprintf (scen_GetLogFP (), "OSTYPE: %s\n", getenv ("OSTYPE"));
-    fprintf (scen_GetLogFP (), "Type of architecture: %u bit\n\n",
-             BYTES_PER_WORD*8);
-    fprintf (scen_GetLogFP (), "Number of CPUs %u \n\n",
-             glb_npes);
-    fprintf (scen_GetLogFP (), "PWD: %s\n", getenv ("PWD"));
-    fprintf (scen_GetLogFP (), "Scenario File: %s\n",
-             scen_GetScenarioFilename ());
-    fprintf (scen_GetLogFP (), "Type of Processing: %s\n",
-             processing_str);
-    fprintf (scen_GetLogFP (), "\n\n");
-
-    scen_echo (scen_GetLogFP ());
-    coeff_LogStart (scen_GetLogFP ());
-    coeff_LogStop (scen_GetLogFP ());
-    coeff_LogStep (scen_GetLogFP ());
-    coeff_LogBestFit (scen_GetLogFP ());
-    scen_CloseLog ();
     tracer = 2;
   }
 
-  /*
-   *
-   * SET UP FLAT MEMORY
-   *
-   */
-#ifdef MPI
-  MPI_Barrier (MPI_COMM_WORLD);
-#endif
-  mem_Init ();
-printf("\nIN MAIN - FINISHED MEM INITIALIZATION\n");
-  if (scen_GetLogFlag ())
-  {
-    scen_Append2Log ();
-    mem_LogPartition (scen_GetLogFP ());
-    mem_CheckMemory (scen_GetLogFP (), __FILE__, func, __LINE__);
-    scen_CloseLog ();
-  }
-#ifdef MPI
-  MPI_Barrier (MPI_COMM_WORLD);
-#endif
-
-  /*
-   *
-   * INITIALIZE LANDUSE
-   *
-   */
-  if (scen_GetDoingLanduseFlag ())
-  {
-    landclass_Init ();
-    if (scen_GetLogLandclassSummaryFlag ())
-    {
-      if (scen_GetLogFlag ())
-      {
-        scen_Append2Log ();
-        landclass_LogIt (scen_GetLogFP ());
-        scen_CloseLog ();
-      }
-    }
-  }
-
-  /*
-   *
-   * INITIALIZE COLORTABLES
-   *
-   */
-  color_Init ();
-
-  /*
-   *
-   * WRITE MEMORY MAPS
-   *
-   */
-  if (scen_GetLogMemoryMapFlag ())
-  {
-    color_MemoryLog (mem_GetLogFP ());
-    coeff_MemoryLog (mem_GetLogFP ());
-    timer_MemoryLog (mem_GetLogFP ());
-    igrid_MemoryLog (mem_GetLogFP ());
-    pgrid_MemoryLog (mem_GetLogFP ());
-    stats_MemoryLog (mem_GetLogFP ());
-    mem_MemoryLog (mem_GetLogFP ());
-    proc_MemoryLog (mem_GetLogFP ());
-    landclass_MemoryLog (mem_GetLogFP ());
-    scen_MemoryLog (mem_GetLogFP ());
-    trans_MemoryLog (mem_GetLogFP ());
-    mem_CloseLog ();
-  }
-
-  /*
-   *
-   * READ INPUT DATA FILES
-   *
-   */
-  igrid_ReadFiles ();
-  if (scen_GetLogFlag ())
-  {
-    scen_Append2Log ();
-    igrid_ValidateGrids (scen_GetLogFP ());
-    scen_CloseLog ();
-  }
-  else
-  {
-    igrid_ValidateGrids (NULL);
-  }
-  igrid_NormalizeRoads ();
-  if (scen_GetLogFlag ())
-  {
-    scen_Append2Log ();
-    igrid_LogIt (scen_GetLogFP ());
-    igrid_VerifyInputs (scen_GetLogFP ());
-    scen_CloseLog ();
-  }
-  else
-  {
-    igrid_VerifyInputs (NULL);
-  }
-
-  /*
-   *
-   * INITIALIZE THE PGRID GRIDS
-   *
-   */
-  pgrid_Init ();
-
-  if (scen_GetLogFlag ())
-  {
-    if (scen_GetLogColortablesFlag ())
-    {
-      scen_Append2Log ();
-      color_LogIt (scen_GetLogFP ());
-      scen_CloseLog ();
-    }
-  }
-
-  /*
-   *
-   * COUNT THE NUMBER OF RUNS
-   *
-   */
-  proc_SetTotalRuns ();
-  if (scen_GetLogFlag ())
-  {
-    if (proc_GetProcessingType () == CALIBRATING)
-    {
-      scen_Append2Log ();
-      fprintf (scen_GetLogFP (), "%s %u Total Number of Runs = %u\n",
-               __FILE__, __LINE__, proc_GetTotalRuns ());
-      scen_CloseLog ();
-    }
-  }
-
-  proc_SetLastMonteCarlo (scen_GetMonteCarloIterations () - 1);
-  /*
-   *
-   * COMPUTE THE TRANSITION MATRIX
-   *
-   */
-  if (scen_GetDoingLanduseFlag ())
-  {
-    trans_Init ();
-    if (scen_GetLogFlag ())
-    {
-      if (scen_GetLogTransitionMatrixFlag ())
-      {
-        scen_Append2Log ();
-        trans_LogTransition (scen_GetLogFP ());
-        scen_CloseLog ();
-      }
-    }
-  }
-
-  /*** D. Donato August 16, 2006  Set up abbreviated data structures for ***
-   ***                            excluded and urban-seed pixels.        **/
-
-   igrid_BuildCompactExcPixFile();
-   igrid_BuildCompactUrbPixFile();
-
-  /*
-   *
-   * COMPUTE THE BASE STATISTICS AGAINST WHICH CALIBRATION WILL TAKE PLACE
-   *
-   */
-  stats_Init ();
-  if (scen_GetLogFlag ())
-  {
-    if (scen_GetLogBaseStatsFlag ())
-    {
-      scen_Append2Log ();
-      stats_LogBaseStats (scen_GetLogFP ());
-      scen_CloseLog ();
-    }
-  }
-  if (scen_GetLogFlag ())
-  {
-    if (scen_GetLogDebugFlag ())
-    {
-      scen_Append2Log ();
-      igrid_Debug (scen_GetLogFP (), __FILE__, __LINE__);
-      scen_CloseLog ();
-    }
-  }
-
-  proc_SetNumRunsExecThisCPU (0);
-  if (proc_GetCurrentRun () == 0 && glb_mype == 0)
-  {
-    if (proc_GetProcessingType () != PREDICTING)
-    {
-      sprintf (fname, "%scontrol_stats.log", scen_GetOutputDir ());
-      stats_CreateControlFile (fname);
-    }
-    if (scen_GetWriteStdDevFileFlag ())
-    {
-      sprintf (fname, "%sstd_dev.log", scen_GetOutputDir ());
-      stats_CreateStatsValFile (fname);
-    }
-    if (scen_GetWriteAvgFileFlag ())
-    {
-      sprintf (fname, "%savg.log", scen_GetOutputDir ());
-      stats_CreateStatsValFile (fname);
-    }
-  }
-
-  coeff_CreateCoeffFile ();
-
-#ifdef MPI
-  MPI_Barrier (MPI_COMM_WORLD);
-#endif
-
   if (proc_GetProcessingType () == PREDICTING)
   {
     /*
@@ -694,27 +274,12 @@ printf("\nIN MAIN - FINISHED MEM INITIALIZATION\n");
      * PREDICTION RUNS
      *
      */
-    proc_SetStopYear (scen_GetPredictionStopDate ());
-    InitRandom (scen_GetRandomSeed ());
-    coeff_SetCurrentDiffusion ((double) coeff_GetBestFitDiffusion ());
-    coeff_SetCurrentSpread ((double) coeff_GetBestFitSpread ());
-    coeff_SetCurrentBreed ((double) coeff_GetBestFitBreed ());
-    coeff_SetCurrentSlopeResist ((double) coeff_GetBestFitSlopeResist ());
-    coeff_SetCurrentRoadGravity ((double) coeff_GetBestFitRoadGravity ());
-    if (glb_mype == 0)
-    {
-      drv_driver ();
-      proc_IncrementNumRunsExecThisCPU ();
-    }
-    if (scen_GetLogFlag ())
-    {
-      if (scen_GetLogTimingsFlag () > 1)
-      {
-        scen_Append2Log ();
-        timer_LogIt (scen_GetLogFP ());
-        scen_CloseLog ();
-      }
-    }
+    sleuth_Run (coeff_GetBestFitDiffusion (),
+                coeff_GetBestFitBreed (),
+                coeff_GetBestFitSpread (),
+                coeff_GetBestFitSlopeResist (),
+                coeff_GetBestFitRoadGravity (),
+                NULL);
   }
   else
   {
@@ -723,9 +288,6 @@ printf("\nIN MAIN - FINISHED MEM INITIALIZATION\n");
      * CALIBRATION AND TEST RUNS
      *
      */
-    proc_SetStopYear (igrid_GetUrbanYear (igrid_GetUrbanCount () - 1));
-
-
     for (diffusion_coeff = coeff_GetStartDiffusion ();
          diffusion_coeff <= coeff_GetStopDiffusion ();
          diffusion_coeff += coeff_GetStepDiffusion ())
@@ -746,104 +308,15 @@ printf("\nIN MAIN - FINISHED MEM INITIALIZATION\n");
                  road_gravity <= coeff_GetStopRoadGravity ();
                  road_gravity += coeff_GetStepRoadGravity ())
             {
-              sprintf (fname, "%s%s%u", scen_GetOutputDir (),
-                       RESTART_FILE, glb_mype);
-              out_write_restart_data (fname,
-                                      diffusion_coeff,
-                                      breed_coeff,
-                                      spread_coeff,
-                                      slope_resistance,
-                                      road_gravity,
-                                      scen_GetRandomSeed (),
-                                      restart_run);
-
-              InitRandom (scen_GetRandomSeed ());
-
-              restart_run++;
-
-              coeff_SetCurrentDiffusion ((double) diffusion_coeff);
-              coeff_SetCurrentSpread ((double) spread_coeff);
-              coeff_SetCurrentBreed ((double) breed_coeff);
-              coeff_SetCurrentSlopeResist ((double) slope_resistance);
-              coeff_SetCurrentRoadGravity ((double) road_gravity);
-
-
-#ifdef MPI
-/*
-   The following "if" statement was modified to divide up runs for
-   process rank (glb_mpye) zero (0) across all process ranks. This
-   reduces the computational load on the console process which 
-   otherwise would take considerably longer to finish processing
-   than the other processes.
-
-   D. Donato - June 5, 2006
-
-*/
-              if (
-                  (proc_GetCurrentRun () % glb_npes != 0 &&
-                   proc_GetCurrentRun () % glb_npes == glb_mype)
-                    ||
-                  (proc_GetCurrentRun () % glb_npes == 0 &&
-                   redistributedloadcount++ % glb_npes == glb_mype)
-                 )
-
-/*            if (proc_GetCurrentRun () % glb_npes == glb_mype)    */
-              {
-                drv_driver ();
-                proc_IncrementNumRunsExecThisCPU ();
-                if (scen_GetLogFlag ())
-                {
-                  if (scen_GetLogTimingsFlag () > 1)
-                  {
-                    scen_Append2Log ();
-                    timer_LogIt (scen_GetLogFP ());
-                    scen_CloseLog ();
-                  }
-                }
-              }
-#else
-              drv_driver ();
-              proc_IncrementNumRunsExecThisCPU ();
-              if (scen_GetLogFlag ())
-              {
-                if (scen_GetLogTimingsFlag () > 1)
-                {
-                  scen_Append2Log ();
-                  timer_LogIt (scen_GetLogFP ());
-                  scen_CloseLog ();
-                }
-              }
-#endif
-
-
-              proc_IncrementCurrentRun ();
+              sleuth_Run (diffusion_coeff,
+                          breed_coeff,
+                          spread_coeff,
+                          slope_resistance,
+                          road_gravity,
+                          NULL);
               if (proc_GetProcessingType () == TESTING)
               {
-                stats_ConcatenateControlFiles ();
-                if (scen_GetWriteCoeffFileFlag ())
-                {
-                  coeff_ConcatenateFiles ();
-                }
-                if (scen_GetWriteAvgFileFlag ())
-                {
-                  stats_ConcatenateAvgFiles ();
-                }
-                if (scen_GetWriteStdDevFileFlag ())
-                {
-                  stats_ConcatenateStdDevFiles ();
-                }
-
-                timer_Stop (TOTAL_TIME);
-                if (scen_GetLogFlag ())
-                {
-                  scen_Append2Log ();
-                  if (scen_GetLogTimingsFlag () > 0)
-                  {
-                    timer_LogIt (scen_GetLogFP ());
-                  }
-                  mem_LogMinFreeWGrids (scen_GetLogFP ());
-                  scen_CloseLog ();
-                }
+                sleuth_Finish ();
                 EXIT (0);
               }
             }
@@ -901,25 +374,7 @@ if (glb_mype == 0)
 /***************************************************/
 
 
-  if (glb_mype == 0)
-  {
-    if (scen_GetWriteCoeffFileFlag ())
-    {
-      coeff_ConcatenateFiles ();
-    }
-    if (scen_GetWriteAvgFileFlag ())
-    {
-      stats_ConcatenateAvgFiles ();
-    }
-    if (scen_GetWriteStdDevFileFlag ())
-    {
-      stats_ConcatenateStdDevFiles ();
-    }
-    if (proc_GetProcessingType () != PREDICTING)
-    {
-      stats_ConcatenateControlFiles ();
-    }
-  }
+  sleuth_Finish ();
 
   if (scen_GetPostprocessingFlag ())
   {
@@ -971,31 +426,6 @@ if (glb_mype == 0)
 #ifdef MPI
   MPI_Finalize ();
 #endif
-  timer_Stop (TOTAL_TIME);
-
-
-  if (scen_GetLogFlag ())
-  {
-    scen_Append2Log ();
-    if (scen_GetLogTimingsFlag () > 0)
-    {
-      timer_LogIt (scen_GetLogFP ());
-    }
-    mem_LogMinFreeWGrids (scen_GetLogFP ());
-    scen_CloseLog ();
-  }
-
-	 /*VerD*/
-
-     if (proc_GetProcessingType () != PREDICTING)
-	 {
-		if (WriteXypointsFileFlag == 1) fclose(fpVerD2);
-
-		if (WriteSlopeFileFlag == 1) fclose(fpVerD3);
-
-		if (WriteRatioFileFlag == 1) fclose(fpVerD4);
-	 }
-	 /*VerD*/
 
   return (0);
 }
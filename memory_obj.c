@@ -35,6 +35,8 @@
 #include "pgrid_obj.h"
 #include "wgrid_obj.h"
 #include "scenario_obj.h"
+#include "spread.h"
+#include "utilities.h"
 #include "ugm_typedefs.h"
 #include "ugm_macros.h"
 #include "memory_obj.h"
@@ -76,7 +78,7 @@ typedef struct
 mem_track_info;
 static int nrows;
 static int ncols;
-static int total_pixels;
+static size_t total_pixels;
 static PIXEL invalid_val;
 static int igrid_free[MEM_ARRAY_SIZE];
 static int igrid_free_tos;
@@ -91,39 +93,87 @@ static mem_track_info wgrid_array[MEM_ARRAY_SIZE];
 static PIXEL *mem_check_array[MEM_ARRAY_SIZE];
 static int mem_check_count;
 static int mem_check_size;
-static int igrid_size;
-static int pgrid_size;
-static int wgrid_size;
-static int bytes_p_grid;
-static int bytes_p_grid_rounded2wordboundary;
-static int bytes_p_packed_grid;
-static int bytes_p_packed_grid_rounded2wordboundary;
-static int bytes2allocate;
+static size_t igrid_size;
+static size_t pgrid_size;
+static size_t wgrid_size;
+static size_t bytes_p_grid;
+static size_t bytes_p_grid_rounded2wordboundary;
+static size_t bytes_p_packed_grid;
+static size_t bytes_p_packed_grid_rounded2wordboundary;
+static size_t bytes2allocate;
 static void *mem_ptr;
 static int igrid_count;
 static int pgrid_count;
 static int wgrid_count;
 static FILE *memlog_fp;
 static char mem_log_filename[MAX_FILENAME_LEN];
+static size_t count_bytes;     /* Bytes of count grids allocated now */
+static size_t max_count_bytes; /* and the most at any one time        */
 
 /* D.D. Added for growth Row and Column (GRC)arrays and for road-pixel-only */
 /*      (RPO) arrays  --  July 28, 2006                                     */
-static void *g_row_ptr;
-static short *g_col_ptr;
-static short *z_row_ptr; /* D.D. 8/17/2006 Added for accumulating urban     */
-static short *z_col_ptr; /*      pixels over year simulations.              */
+/*      The lists hold int pixel offsets, not short rows and columns.     */
+static int  *g_off_ptr;
+static int  *z_off_ptr;  /* D.D. 8/17/2006 Added for accumulating urban     */
+                         /*      pixels over year simulations.              */
 static int   zgrwthcount;/*                                                 */
 static GRID_P zgrwthpointer;
-static int bytes2allocateGRC;
+static GRID_P nbrcount_ptr; /* Urban neighbor counts (NEIGHBOR_COUNT_GRID) */
+static int  *f_off_ptr;     /* Urban frontier for phase 4 (ORGANIC_FRONTIER) */
+static int   frontiercount;
+static int  *elig_ptr;      /* Pixels that may urbanize (ELIGIBLE_CELL_SAMPLING) */
+static int  *eligpos_ptr;   /* Position of each pixel in elig_ptr, or -1 */
+static int  *active_ptr;    /* Pixels that are not excluded or are urban (ACTIVE_DOMAIN) */
+static int   activecount;
+static int   activewindow[4]; /* First and last row and col of the active domain */
+static int   eligcount;
+static unsigned short *accept_ptr; /* Fused acceptance (FUSED_ACCEPTANCE_GRID) */
+static MASK_WORD *zmask_ptr;      /* Bit masks (URBAN_BIT_MASKS): urban pixels */
+static MASK_WORD *spreadmask_ptr; /* of z, phase 4 candidates, and the urban   */
+static MASK_WORD *urbmask_ptr;    /* input grids, one after the other          */
+static int mask_words;
+static int  *claim_ptr;     /* Parallel phase 4 (PARALLEL_ORGANIC_GROWTH):     */
+static int  *cand_ptr;      /* claimant of each pixel, outcome of each attempt */
+static MASK_WORD *repz_ptr;     /* Bit-sliced replicas (BIT_SLICED_REPLICAS):  */
+static MASK_WORD *repdelta_ptr; /* z, delta and scratch, one bit per replica,  */
+static MASK_WORD *repwork_ptr;  /* and lists of pixels urban in any replica,   */
+static int  *repzlist_ptr;      /* grown this year, that may spread, and one   */
+static int  *repglist_ptr;      /* for a single replica                        */
+static int  *repslist_ptr;
+static int  *replane_ptr;
+static int   repzcount;
+static size_t bytes2allocateGRC;
+static size_t bytes2allocateGRZ;
 
 static int bytes2allocateRPOcol;
-static short *rporowNum_ptr[15];
-static short *rporowMin_ptr[15];
-static short *rporowMax_ptr[15];
+static int   *rporowNum_ptr[15];
+static int   *rporowMin_ptr[15];
+static int   *rporowMax_ptr[15];
 static int   *rporowIdx_ptr[15];
-static short *rpocol_ptr[15];
+static int   *rpocol_ptr[15];
+static int   *rponear_ptr[15];
+static int   *rponearCol_ptr[15];
+static int   *rponearIdx_ptr[15];
+static int   *rponearList_ptr[15];
+static int   *rponodeOff_ptr[15];
+static int   *rponodeNbr_ptr[15];
+static unsigned char *rponodeMask_ptr[15];
+static PIXEL *rponodeVal_ptr[15];
 /**  D.D.  July 28, 2006                                   *******************/
 
+/* each thread of a PARALLEL_MONTE_CARLO pool has its own pgrids, wgrids */
+/* and growth arrays (see mem_ThreadInit); the input grids, the urban   */
+/* masks, the active domain and the road search arrays are shared       */
+#ifdef _OPENMP
+#pragma omp threadprivate (pgrid_free, pgrid_free_tos, pgrid_array)
+#pragma omp threadprivate (wgrid_free, wgrid_free_tos, min_wgrid_free_tos)
+#pragma omp threadprivate (wgrid_array, g_off_ptr, z_off_ptr, zgrwthcount)
+#pragma omp threadprivate (zgrwthpointer, nbrcount_ptr, f_off_ptr)
+#pragma omp threadprivate (frontiercount, elig_ptr, eligpos_ptr, eligcount)
+#pragma omp threadprivate (accept_ptr, zmask_ptr, spreadmask_ptr)
+#pragma omp threadprivate (claim_ptr, cand_ptr)
+#endif
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -165,7 +215,7 @@ void
 {
   LOG_MEM (fp, &nrows, sizeof (int), 1);
   LOG_MEM (fp, &ncols, sizeof (int), 1);
-  LOG_MEM (fp, &total_pixels, sizeof (int), 1);
+  LOG_MEM (fp, &total_pixels, sizeof (size_t), 1);
   LOG_MEM (fp, &invalid_val, sizeof (PIXEL), 1);
 
   LOG_MEM (fp, &igrid_free[0], sizeof (int), MEM_ARRAY_SIZE);
@@ -183,20 +233,22 @@ void
 
   LOG_MEM (fp, &mem_check_count, sizeof (int), 1);
   LOG_MEM (fp, &mem_check_size, sizeof (int), 1);
-  LOG_MEM (fp, &igrid_size, sizeof (int), 1);
-  LOG_MEM (fp, &pgrid_size, sizeof (int), 1);
-  LOG_MEM (fp, &wgrid_size, sizeof (int), 1);
-
-  LOG_MEM (fp, &bytes_p_grid, sizeof (int), 1);
-  LOG_MEM (fp, &bytes_p_grid_rounded2wordboundary, sizeof (int), 1);
-  LOG_MEM (fp, &bytes_p_packed_grid, sizeof (int), 1);
-  LOG_MEM (fp, &bytes_p_packed_grid_rounded2wordboundary, sizeof (int), 1);
-  LOG_MEM (fp, &bytes2allocate, sizeof (int), 1);
+  LOG_MEM (fp, &igrid_size, sizeof (size_t), 1);
+  LOG_MEM (fp, &pgrid_size, sizeof (size_t), 1);
+  LOG_MEM (fp, &wgrid_size, sizeof (size_t), 1);
+
+  LOG_MEM (fp, &bytes_p_grid, sizeof (size_t), 1);
+  LOG_MEM (fp, &bytes_p_grid_rounded2wordboundary, sizeof (size_t), 1);
+  LOG_MEM (fp, &bytes_p_packed_grid, sizeof (size_t), 1);
+  LOG_MEM (fp, &bytes_p_packed_grid_rounded2wordboundary, sizeof (size_t), 1);
+  LOG_MEM (fp, &bytes2allocate, sizeof (size_t), 1);
   LOG_MEM (fp, &mem_ptr, sizeof (void *), 1);
   LOG_MEM (fp, &igrid_count, sizeof (int), 1);
   LOG_MEM (fp, &pgrid_count, sizeof (int), 1);
   LOG_MEM (fp, &wgrid_count, sizeof (int), 1);
   LOG_MEM (fp, &memlog_fp, sizeof (FILE *), 1);
+  LOG_MEM (fp, &count_bytes, sizeof (size_t), 1);
+  LOG_MEM (fp, &max_count_bytes, sizeof (size_t), 1);
 }
 
 /******************************************************************************
@@ -210,7 +262,7 @@ void
 **
 **
 */
-int
+size_t
   mem_GetPackedBytesPerGrid ()
 {
   return bytes_p_packed_grid_rounded2wordboundary;
@@ -224,13 +276,18 @@ int
 ** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
 ** CREATION DATE: 11/11/1999
 ** DESCRIPTION:
-**
+**                10/17/2026 (SLEUTH-3r maintainers): the count is kept
+**                as a size_t, but always fits an int, as mem_Init
+**                stops at INT_MAX pixels (see there). Rows and columns
+**                past 32767 and grids past 2 GB are supported; grids
+**                past 2^31 pixels are not, as OFFSET and every pixel
+**                list hold int offsets.
 **
 */
 int
   mem_GetTotalPixels ()
 {
-  return total_pixels;
+  return (int) total_pixels;
 }
 
 /******************************************************************************
@@ -346,6 +403,76 @@ GRID_P
   return NULL;
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_CountGridAlloc
+** PURPOSE:       allocate the counts of a count grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Count grids live outside the grid partition, so their
+**                bytes are added up here and, with WRITE_MEMORY_MAP,
+**                each allocation is written to the memory log.
+**
+*/
+void *
+  mem_CountGridAlloc (size_t num_bytes)                      /* IN     */
+{
+  char func[] = "mem_CountGridAlloc";
+  void *ptr;
+
+  ptr = calloc (num_bytes, 1);
+  if (ptr == NULL)
+  {
+    sprintf (msg_buf, "Unable to allocate %lu bytes of memory (counts)",
+             (unsigned long) num_bytes);
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  count_bytes += num_bytes;
+  if (count_bytes > max_count_bytes)
+  {
+    max_count_bytes = count_bytes;
+  }
+  if (scen_GetLogMemoryMapFlag ())
+  {
+    fprintf (mem_GetLogFP (),
+             "%s %d Allocated %lu bytes of memory (counts) count_bytes=%lu "
+             "max_count_bytes=%lu\n", __FILE__, __LINE__,
+             (unsigned long) num_bytes, (unsigned long) count_bytes,
+             (unsigned long) max_count_bytes);
+    mem_CloseLog ();
+  }
+  return ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_CountGridFree
+** PURPOSE:       free the counts of a count grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   num_bytes is the size passed to mem_CountGridAlloc.
+**
+**
+*/
+void
+  mem_CountGridFree (void *ptr,                              /* IN     */
+                     size_t num_bytes)                       /* IN     */
+{
+  free (ptr);
+  count_bytes -= num_bytes;
+  if (scen_GetLogMemoryMapFlag ())
+  {
+    fprintf (mem_GetLogFP (),
+             "%s %d Freed %lu bytes of memory (counts) count_bytes=%lu\n",
+             __FILE__, __LINE__, (unsigned long) num_bytes,
+             (unsigned long) count_bytes);
+    mem_CloseLog ();
+  }
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: mem_Init
@@ -379,7 +506,18 @@ void
   wgrid_free_tos = 0;
   nrows = igrid_GetNumRows ();
   ncols = igrid_GetNumCols ();
-  total_pixels = nrows * ncols;
+  /* Grid sizes and byte counts are size_t, but every list of pixels  */
+  /* (growth, frontier, eligible and active cells, RPO columns) holds */
+  /* int linear offsets, as does OFFSET, so a grid stops at INT_MAX   */
+  /* pixels. 64-bit offsets would double the memory of every list.    */
+  total_pixels = (size_t) nrows * ncols;
+  if (total_pixels > INT_MAX)
+  {
+    sprintf (msg_buf, "%d x %d grid exceeds the %d pixels an int linear offset can address",
+             nrows, ncols, INT_MAX);
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
   igrid_count = igrid_GetIGridCount ();
   pgrid_count = pgrid_GetPGridCount ();
   wgrid_count = wgrid_GetWGridCount ();
@@ -393,15 +531,17 @@ void
   bytes_p_packed_grid = BYTES_PER_PIXEL_PACKED * total_pixels;
   bytes_p_packed_grid_rounded2wordboundary =
     ROUND_BYTES_TO_WORD_BNDRY (bytes_p_packed_grid);
-  bytes2allocate = igrid_count * bytes_p_packed_grid_rounded2wordboundary +
-    pgrid_count * bytes_p_grid_rounded2wordboundary +
-    wgrid_count * bytes_p_grid_rounded2wordboundary +
+  bytes2allocate =
+    (size_t) igrid_count * bytes_p_packed_grid_rounded2wordboundary +
+    (size_t) pgrid_count * bytes_p_grid_rounded2wordboundary +
+    (size_t) wgrid_count * bytes_p_grid_rounded2wordboundary +
     check_pixel_count * BYTES_PER_PIXEL;
   igrid_size = bytes_p_packed_grid_rounded2wordboundary / BYTES_PER_WORD;
 #else
-  bytes2allocate = igrid_count * bytes_p_grid_rounded2wordboundary +
-    pgrid_count * bytes_p_grid_rounded2wordboundary +
-    wgrid_count * bytes_p_grid_rounded2wordboundary +
+  bytes2allocate =
+    (size_t) igrid_count * bytes_p_grid_rounded2wordboundary +
+    (size_t) pgrid_count * bytes_p_grid_rounded2wordboundary +
+    (size_t) wgrid_count * bytes_p_grid_rounded2wordboundary +
     check_pixel_count * BYTES_PER_PIXEL;
   igrid_size = bytes_p_grid_rounded2wordboundary / BYTES_PER_WORD;
 
@@ -409,11 +549,13 @@ void
 /*        Allows for up to half the pixels in a grid to be used for new     ***/
 /*        growth pixels or 15,000,000 - whichever is less.   (8/17/2006)       ***/
 /*   D.D. Type of storage to be allocated changed from int to short 8/10/2006 */
-  if (bytes_p_grid_rounded2wordboundary/2 > 15000000) {bytes2allocateGRC=15000000*sizeof(short);}
-      else
-  {bytes2allocateGRC = (bytes_p_grid_rounded2wordboundary/2)*sizeof(short);}
+/*   10/17/2026 Back to int, now one offset per pixel instead of a short    ***/
+/*        row and column; the 15,000,000 ceiling is dropped and the         ***/
+/*        cumulative growth list gets room for every pixel.                 ***/
 
 #endif
+  bytes2allocateGRC = (size_t) (total_pixels / 2 + 1) * sizeof (int);
+  bytes2allocateGRZ = (size_t) total_pixels * sizeof (int);
   mem_check_size = 1;
   pgrid_size = bytes_p_grid_rounded2wordboundary / BYTES_PER_WORD;
   wgrid_size = bytes_p_grid_rounded2wordboundary / BYTES_PER_WORD;
@@ -423,30 +565,31 @@ void
   {
     fprintf (memlog_fp, "nrows = %u\n", nrows);
     fprintf (memlog_fp, "ncols = %u\n", ncols);
-    fprintf (memlog_fp, "total_pixels = %u\n", total_pixels);
+    fprintf (memlog_fp, "total_pixels = %lu\n", (unsigned long) total_pixels);
     fprintf (memlog_fp, "igrid_count = %u\n", igrid_count);
     fprintf (memlog_fp, "pgrid_count = %u\n", pgrid_count);
     fprintf (memlog_fp, "wgrid_count = %u\n", wgrid_count);
     fprintf (memlog_fp, "check_pixel_count = %u\n", check_pixel_count);
-    fprintf (memlog_fp, "BYTES_PER_WORD = %u\n", BYTES_PER_WORD);
-    fprintf (memlog_fp, "BYTES_PER_PIXEL = %u\n", BYTES_PER_PIXEL);
-    fprintf (memlog_fp, "bytes_p_grid = %u\n", bytes_p_grid);
-    fprintf (memlog_fp, "bytes_p_grid_rounded2wordboundary = %u\n",
-             bytes_p_grid_rounded2wordboundary);
-    fprintf (memlog_fp, "words in a grid = %u\n",
-             bytes_p_grid_rounded2wordboundary / BYTES_PER_WORD);
+    fprintf (memlog_fp, "BYTES_PER_WORD = %lu\n", (unsigned long) BYTES_PER_WORD);
+    fprintf (memlog_fp, "BYTES_PER_PIXEL = %lu\n", (unsigned long) BYTES_PER_PIXEL);
+    fprintf (memlog_fp, "bytes_p_grid = %lu\n", (unsigned long) bytes_p_grid);
+    fprintf (memlog_fp, "bytes_p_grid_rounded2wordboundary = %lu\n",
+             (unsigned long) bytes_p_grid_rounded2wordboundary);
+    fprintf (memlog_fp, "words in a grid = %lu\n",
+             (unsigned long) (bytes_p_grid_rounded2wordboundary / BYTES_PER_WORD));
 #ifdef PACKING
     fprintf (memlog_fp, "BYTES_PER_PIXEL_PACKED = %u\n",
              BYTES_PER_PIXEL_PACKED);
-    fprintf (memlog_fp, "bytes_p_packed_grid = %u\n", bytes_p_packed_grid);
-    fprintf (memlog_fp, "bytes_p_packed_grid_rounded2wordboundary = %u\n",
-             bytes_p_packed_grid_rounded2wordboundary);
+    fprintf (memlog_fp, "bytes_p_packed_grid = %lu\n",
+             (unsigned long) bytes_p_packed_grid);
+    fprintf (memlog_fp, "bytes_p_packed_grid_rounded2wordboundary = %lu\n",
+             (unsigned long) bytes_p_packed_grid_rounded2wordboundary);
 #endif
-    fprintf (memlog_fp, "igrid_size = %u words\n", igrid_size);
-    fprintf (memlog_fp, "pgrid_size = %u words\n", pgrid_size);
-    fprintf (memlog_fp, "wgrid_size = %u words\n", wgrid_size);
+    fprintf (memlog_fp, "igrid_size = %lu words\n", (unsigned long) igrid_size);
+    fprintf (memlog_fp, "pgrid_size = %lu words\n", (unsigned long) pgrid_size);
+    fprintf (memlog_fp, "wgrid_size = %lu words\n", (unsigned long) wgrid_size);
     fprintf (memlog_fp, "mem_check_size = %u words\n", mem_check_size);
-    fprintf (memlog_fp, "bytes2allocate = %u\n", bytes2allocate);
+    fprintf (memlog_fp, "bytes2allocate = %lu\n", (unsigned long) bytes2allocate);
   }
 
   mem_allocate ();
@@ -455,6 +598,120 @@ void
   mem_CloseLog ();
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_ThreadInit
+** PURPOSE:       give the calling thread its own grids and growth arrays
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                For a thread of a PARALLEL_MONTE_CARLO pool, sets up
+**                what mem_allocate and mem_partition set up for the
+**                pgrids, the wgrids and the per-iteration arrays, as
+**                the scenario needs them. Does nothing for the master,
+**                or for a thread that has them already.
+**
+*/
+void
+  mem_ThreadInit ()
+{
+  char func[] = "mem_ThreadInit";
+  PIXEL *temp_ptr;
+  size_t bytes;
+  int i;
+
+  if (wgrid_array[0].ptr != NULL)
+  {
+    return;
+  }
+  bytes = (pgrid_count * pgrid_size + wgrid_count * wgrid_size) *
+    BYTES_PER_WORD;
+  temp_ptr = (PIXEL *) malloc (bytes);
+  g_off_ptr = malloc (bytes2allocateGRC);
+  z_off_ptr = malloc (bytes2allocateGRZ);
+  if ( (temp_ptr == NULL) || (g_off_ptr == NULL) || (z_off_ptr == NULL) )
+  {
+    sprintf (msg_buf, "Unable to allocate %lu bytes of memory (thread)",
+             (unsigned long) (bytes + bytes2allocateGRC + bytes2allocateGRZ));
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  memset (temp_ptr, 0, bytes);
+  pgrid_free_tos = 0;
+  for (i = 0; i < pgrid_count; i++)
+  {
+    pgrid_array[i].ptr = (GRID_P) temp_ptr;
+    temp_ptr += pgrid_size;
+    strcpy (pgrid_array[i].current_owner, "");
+    mem_pgrid_push (i);
+  }
+  wgrid_free_tos = 0;
+  for (i = 0; i < wgrid_count; i++)
+  {
+    wgrid_array[i].ptr = (GRID_P) temp_ptr;
+    mem_InvalidateGrid (wgrid_array[i].ptr);
+    temp_ptr += wgrid_size;
+    strcpy (wgrid_array[i].current_owner, "");
+    mem_wgrid_push (i);
+  }
+  min_wgrid_free_tos = wgrid_free_tos;
+  zgrwthcount = 0;
+  frontiercount = 0;
+  eligcount = 0;
+
+  if (scen_GetNeighborCountGridFlag () ||
+      (scen_GetOrganicFrontier () != ORGANIC_FRONTIER_OFF))
+  {
+    nbrcount_ptr = calloc (mem_GetTotalPixels (), sizeof (PIXEL));
+  }
+  if (scen_GetOrganicFrontier () == ORGANIC_FRONTIER_ON)
+  {
+    f_off_ptr = malloc (bytes2allocateGRZ);
+  }
+  if (scen_GetEligibleCellSamplingFlag ())
+  {
+    elig_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    eligpos_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+  }
+  if (scen_GetFusedAcceptanceGridFlag ())
+  {
+    accept_ptr = malloc (mem_GetTotalPixels () * sizeof (unsigned short));
+  }
+  if (scen_GetUrbanBitMasksFlag ())
+  {
+    zmask_ptr = calloc (mask_words, sizeof (MASK_WORD));
+    spreadmask_ptr = malloc (mask_words * sizeof (MASK_WORD));
+  }
+  if (scen_GetParallelOrganicGrowthFlag ())
+  {
+    claim_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    cand_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    if (claim_ptr != NULL)
+    {
+      for (i = 0; i < mem_GetTotalPixels (); i++)
+      {
+        claim_ptr[i] = -1;
+      }
+    }
+  }
+  if (((nbrcount_ptr == NULL) && scen_GetNeighborCountGridFlag ()) ||
+      ((f_off_ptr == NULL) &&
+       (scen_GetOrganicFrontier () == ORGANIC_FRONTIER_ON)) ||
+      ((elig_ptr == NULL || eligpos_ptr == NULL) &&
+       scen_GetEligibleCellSamplingFlag ()) ||
+      ((accept_ptr == NULL) && scen_GetFusedAcceptanceGridFlag ()) ||
+      ((zmask_ptr == NULL || spreadmask_ptr == NULL) &&
+       scen_GetUrbanBitMasksFlag ()) ||
+      ((claim_ptr == NULL || cand_ptr == NULL) &&
+       scen_GetParallelOrganicGrowthFlag ()))
+  {
+    sprintf (msg_buf, "Unable to allocate memory (thread arrays)");
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: mem_GetLogFP
@@ -762,84 +1019,268 @@ static void
   mem_ptr = malloc (bytes2allocate);
   if (mem_ptr == NULL)
   {
-    sprintf (msg_buf, "Unable to allocate %u bytes of memory", bytes2allocate);
+    sprintf (msg_buf, "Unable to allocate %lu bytes of memory",
+             (unsigned long) bytes2allocate);
     LOG_ERROR (msg_buf);
     EXIT (1);
   }
   if (scen_GetLogFlag ())
   {
     scen_Append2Log ();
-    fprintf (scen_GetLogFP (), "%s %u Allocated %u bytes of memory\n",
-             __FILE__, __LINE__, bytes2allocate);
+    fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory\n",
+             __FILE__, __LINE__, (unsigned long) bytes2allocate);
     scen_CloseLog ();
   }
   memset (mem_ptr, 0, bytes2allocate);
 
-  /** Allocate memory for the growth row arrays. **/
-  g_row_ptr = malloc (bytes2allocateGRC);
-/* D.D. 8/24/2006 Allow Z to use twice the pixels of delta            ***
-** when bytes2allocateGRC is less than 7,500,000.                     **/
-  if (bytes2allocateGRC < 7500000) { z_row_ptr = malloc (2*bytes2allocateGRC); }
-     else { z_row_ptr = malloc ( bytes2allocateGRC); }
-
-  if ( (g_row_ptr == NULL) || (z_row_ptr == NULL) )
+  /** Allocate memory for the growth and cumulative growth lists. **/
+  g_off_ptr = malloc (bytes2allocateGRC);
+  z_off_ptr = malloc (bytes2allocateGRZ);
+  if ( (g_off_ptr == NULL) || (z_off_ptr == NULL) )
   {
-    sprintf (msg_buf, "Unable to allocate %u bytes of memory (GRC row)", bytes2allocateGRC*3);
+    sprintf (msg_buf, "Unable to allocate %lu bytes of memory (GRC)",
+             (unsigned long) (bytes2allocateGRC + bytes2allocateGRZ));
     LOG_ERROR (msg_buf);
     EXIT (1);
   }
   if (scen_GetLogFlag ())
   {
     scen_Append2Log ();
-    fprintf (scen_GetLogFP (), "%s %u Allocated %u bytes of memory (GRC row)\n",
-             __FILE__, __LINE__, bytes2allocateGRC);
+    fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (GRC)\n",
+             __FILE__, __LINE__,
+             (unsigned long) (bytes2allocateGRC + bytes2allocateGRZ));
     scen_CloseLog ();
   }
-  
-  /** Allocate memory for the growth col arrays. **/
-  g_col_ptr = malloc (bytes2allocateGRC);
-/* D.D. 8/24/2006 Allow Z to use twice the pixels of delta            ***
-** when bytes2allocateGRC is less than 7,500,000.                     **/
-  if (bytes2allocateGRC < 7500000) { z_col_ptr = malloc (2*bytes2allocateGRC); }
-     else { z_col_ptr = malloc ( bytes2allocateGRC); }
-  if ( (g_col_ptr == NULL) || (z_col_ptr == NULL) )
+ 
+  /** Allocate memory for the urban neighbor count grid. **/
+  nbrcount_ptr = NULL;
+  if (scen_GetNeighborCountGridFlag () ||
+      (scen_GetOrganicFrontier () != ORGANIC_FRONTIER_OFF))
   {
-    sprintf (msg_buf, "Unable to allocate %u bytes of memory (GRC col)", bytes2allocateGRC*3);
-    LOG_ERROR (msg_buf);
-    EXIT (1);
+    nbrcount_ptr = malloc (mem_GetTotalPixels () * sizeof (PIXEL));
+    if (nbrcount_ptr == NULL)
+    {
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (neighbor count)",
+               (unsigned long) (mem_GetTotalPixels () * sizeof (PIXEL)));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+    memset (nbrcount_ptr, 0, mem_GetTotalPixels () * sizeof (PIXEL));
+    if (scen_GetLogFlag ())
+    {
+      scen_Append2Log ();
+      fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (neighbor count)\n",
+               __FILE__, __LINE__, (unsigned long) (mem_GetTotalPixels () * sizeof (PIXEL)));
+      scen_CloseLog ();
+    }
   }
-  if (scen_GetLogFlag ())
+
+  /** Allocate memory for the urban frontier arrays; they never hold **/
+  /** more pixels than the cumulative growth arrays.                 **/
+  f_off_ptr = NULL;
+  if (scen_GetOrganicFrontier () == ORGANIC_FRONTIER_ON)
   {
-    scen_Append2Log ();
-    fprintf (scen_GetLogFP (), "%s %u Allocated %u bytes of memory (GRC col)\n",
-             __FILE__, __LINE__, bytes2allocateGRC);
-    scen_CloseLog ();
+    f_off_ptr = malloc (bytes2allocateGRZ);
+    if (f_off_ptr == NULL)
+    {
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (frontier)",
+               (unsigned long) bytes2allocateGRZ);
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
   }
- 
+  frontiercount = 0;
+
+  /** Allocate memory for the eligible cell index. **/
+  elig_ptr = NULL;
+  eligpos_ptr = NULL;
+  if (scen_GetEligibleCellSamplingFlag ())
+  {
+    elig_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    eligpos_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    if ( (elig_ptr == NULL) || (eligpos_ptr == NULL) )
+    {
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (eligible cells)",
+               (unsigned long) (2 * mem_GetTotalPixels () * sizeof (int)));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+    if (scen_GetLogFlag ())
+    {
+      scen_Append2Log ();
+      fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (eligible cells)\n",
+               __FILE__, __LINE__, (unsigned long) (2 * mem_GetTotalPixels () * sizeof (int)));
+      scen_CloseLog ();
+    }
+  }
+  eligcount = 0;
+
+  /** Allocate memory for the active domain. **/
+  active_ptr = NULL;
+  if (scen_GetActiveDomainFlag ())
+  {
+    active_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    if (active_ptr == NULL)
+    {
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (active domain)",
+               (unsigned long) (mem_GetTotalPixels () * sizeof (int)));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+    if (scen_GetLogFlag ())
+    {
+      scen_Append2Log ();
+      fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (active domain)\n",
+               __FILE__, __LINE__, (unsigned long) (mem_GetTotalPixels () * sizeof (int)));
+      scen_CloseLog ();
+    }
+  }
+  activecount = 0;
+  mem_SetActiveWindow (0, igrid_GetNumRows () - 1, 0, igrid_GetNumCols () - 1);
+
+  /** Allocate memory for the fused acceptance grid. **/
+  accept_ptr = NULL;
+  if (scen_GetFusedAcceptanceGridFlag ())
+  {
+    accept_ptr = malloc (mem_GetTotalPixels () * sizeof (unsigned short));
+    if (accept_ptr == NULL)
+    {
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (acceptance grid)",
+               (unsigned long) (mem_GetTotalPixels () * sizeof (unsigned short)));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+    if (scen_GetLogFlag ())
+    {
+      scen_Append2Log ();
+      fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (acceptance grid)\n",
+               __FILE__, __LINE__, (unsigned long) (mem_GetTotalPixels () * sizeof (unsigned short)));
+      scen_CloseLog ();
+    }
+  }
+
+  /** Allocate memory for the bit masks. **/
+  zmask_ptr = NULL;
+  spreadmask_ptr = NULL;
+  urbmask_ptr = NULL;
+  mask_words = igrid_GetNumRows () * MASK_WORDS_PER_ROW (igrid_GetNumCols ());
+  if (scen_GetUrbanBitMasksFlag ())
+  {
+    zmask_ptr = malloc (mask_words * sizeof (MASK_WORD));
+    spreadmask_ptr = malloc (mask_words * sizeof (MASK_WORD));
+    urbmask_ptr = malloc (igrid_GetUrbanCount () * mask_words * sizeof (MASK_WORD));
+    if ( (zmask_ptr == NULL) || (spreadmask_ptr == NULL) || (urbmask_ptr == NULL) )
+    {
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (bit masks)",
+               (unsigned long) ((2 + igrid_GetUrbanCount ()) * mask_words * sizeof (MASK_WORD)));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+    memset (zmask_ptr, 0, mask_words * sizeof (MASK_WORD));
+    if (scen_GetLogFlag ())
+    {
+      scen_Append2Log ();
+      fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (bit masks)\n",
+               __FILE__, __LINE__,
+               (unsigned long) ((2 + igrid_GetUrbanCount ()) * mask_words * sizeof (MASK_WORD)));
+      scen_CloseLog ();
+    }
+  }
+
+  /** Allocate memory for the parallel phase 4 claims. **/
+  claim_ptr = NULL;
+  cand_ptr = NULL;
+  if (scen_GetParallelOrganicGrowthFlag ())
+  {
+    claim_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    cand_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    if ( (claim_ptr == NULL) || (cand_ptr == NULL) )
+    {
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (phase 4 claims)",
+               (unsigned long) (2 * mem_GetTotalPixels () * sizeof (int)));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+    for (i = 0; i < mem_GetTotalPixels (); i++)
+    {
+      claim_ptr[i] = -1;
+    }
+    if (scen_GetLogFlag ())
+    {
+      scen_Append2Log ();
+      fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (phase 4 claims)\n",
+               __FILE__, __LINE__, (unsigned long) (2 * mem_GetTotalPixels () * sizeof (int)));
+      scen_CloseLog ();
+    }
+  }
+
+  /** Allocate memory for the bit-sliced replicas. **/
+  repz_ptr = NULL;
+  repdelta_ptr = NULL;
+  repwork_ptr = NULL;
+  repzlist_ptr = NULL;
+  repglist_ptr = NULL;
+  repslist_ptr = NULL;
+  replane_ptr = NULL;
+  if (scen_GetBitSlicedReplicasFlag ())
+  {
+    repz_ptr = malloc (mem_GetTotalPixels () * sizeof (MASK_WORD));
+    repdelta_ptr = malloc (mem_GetTotalPixels () * sizeof (MASK_WORD));
+    repwork_ptr = malloc (mem_GetTotalPixels () * sizeof (MASK_WORD));
+    repzlist_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    repglist_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    repslist_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    replane_ptr = malloc (mem_GetTotalPixels () * sizeof (int));
+    if ( (repz_ptr == NULL) || (repdelta_ptr == NULL) || (repwork_ptr == NULL) ||
+         (repzlist_ptr == NULL) || (repglist_ptr == NULL) ||
+         (repslist_ptr == NULL) || (replane_ptr == NULL) )
+    {
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (bit-sliced replicas)",
+               (unsigned long) (mem_GetTotalPixels () * (3 * sizeof (MASK_WORD) + 4 * sizeof (int))));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+    memset (repz_ptr, 0, mem_GetTotalPixels () * sizeof (MASK_WORD));
+    memset (repdelta_ptr, 0, mem_GetTotalPixels () * sizeof (MASK_WORD));
+    memset (repwork_ptr, 0, mem_GetTotalPixels () * sizeof (MASK_WORD));
+    if (scen_GetLogFlag ())
+    {
+      scen_Append2Log ();
+      fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (bit-sliced replicas)\n",
+               __FILE__, __LINE__,
+               (unsigned long) (mem_GetTotalPixels () * (3 * sizeof (MASK_WORD) + 4 * sizeof (int))));
+      scen_CloseLog ();
+    }
+  }
+  repzcount = 0;
+
   /** Allocate memory for the Road-Pixel-Only row arrays. **/
   /** "sizeof(int)" changed to "sizeof(short)" 8/10/2006  **/
+  /** and back to "sizeof(int)" for wide grids 10/17/2026  **/
   for (i=0; i<scen_GetRoadDataFileCount(); i++)
        {
-        rporowNum_ptr[i] = malloc(nrows*sizeof(short));
-        rporowMin_ptr[i] = malloc(nrows*sizeof(short));
-        rporowMax_ptr[i] = malloc(nrows*sizeof(short));
+        rporowNum_ptr[i] = malloc(nrows*sizeof(int  ));
+        rporowMin_ptr[i] = malloc(nrows*sizeof(int  ));
+        rporowMax_ptr[i] = malloc(nrows*sizeof(int  ));
         rporowIdx_ptr[i] = malloc(nrows*sizeof(int  ));
+        rponearIdx_ptr[i] = malloc((nrows+1)*sizeof(int  ));
             if (
                 rporowNum_ptr[i] == NULL ||
                 rporowMin_ptr[i] == NULL ||
                 rporowMax_ptr[i] == NULL ||
-                rporowIdx_ptr[i] == NULL 
+                rporowIdx_ptr[i] == NULL ||
+                rponearIdx_ptr[i] == NULL 
                )
             {
-             sprintf (msg_buf, "Unable to allocate %u bytes of memory (RPO row)", 3*nrows*sizeof(short)+nrows*sizeof(int));
+             sprintf (msg_buf, "Unable to allocate %lu bytes of memory (RPO row)", (unsigned long) ((5*nrows+1)*sizeof(int)));
              LOG_ERROR (msg_buf);
              EXIT (1);
             }
             if (scen_GetLogFlag ())
             {
              scen_Append2Log ();
-             fprintf (scen_GetLogFP (), "%s %u Allocated %u bytes of memory (RPO row)\n",
-                      __FILE__, __LINE__, 4*nrows*sizeof(short));
+             fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (RPO row)\n",
+                      __FILE__, __LINE__, (unsigned long) ((5*nrows+1)*sizeof(int)));
              scen_CloseLog ();
             }
        }
@@ -1045,7 +1486,7 @@ void
 **
 **
 */
-int
+size_t
   memGetBytesPerGridRound ()
 {
   return bytes_p_grid_rounded2wordboundary;
@@ -1113,37 +1554,22 @@ void
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: mem_GetGRCrowptr
-** PURPOSE:       return a pointer to memory allocated for the GRC row array
+** FUNCTION NAME: mem_GetGRCoffptr
+** PURPOSE:       return a pointer to memory allocated for the GRC array
 ** AUTHOR:        David I. Donato
 ** PROGRAMMER:    David I. Donato
 ** CREATION DATE: 07/24/2006
 ** DESCRIPTION:   Returns a pointer to the starting memory location for the
-**                row array used to keep track of new growth pixels.
+**                array used to keep track of new growth pixels, by offset.
 **
-*/
-short*
-  mem_GetGRCrowptr ()
-{
-  return g_row_ptr;
-}
-
-
-/******************************************************************************
-*******************************************************************************
-** FUNCTION NAME: mem_GetGRCcolptr
-** PURPOSE:       return a pointer to memory allocated for the GRC col array
-** AUTHOR:        David I. Donato
-** PROGRAMMER:    David I. Donato
-** CREATION DATE: 07/24/2006
-** DESCRIPTION:   Returns a pointer to the starting memory location for the
-**                column array used to keep track of new growth pixels.
+**                10/17/2026 (SLEUTH-3r maintainers): one int offset per
+**                pixel replaces the short row and column arrays.
 **
 */
-short*
-  mem_GetGRCcolptr ()
+int*
+  mem_GetGRCoffptr ()
 {
-  return g_col_ptr;
+  return g_off_ptr;
 }
 
 
@@ -1158,7 +1584,7 @@ short*
 **                Road-Pixel-Only row array for the number of columns with
 **                road pixels in the row. The argument is the row number.
 */
-short*
+int*
   mem_GetRPOrowptrNum (int i)
 {
   return rporowNum_ptr[i];
@@ -1175,7 +1601,7 @@ short*
 **                Road-Pixel-Only row array for the minimum column with a road
 **                pixel in the row. The argument is the row number.
 */
-short*
+int*
   mem_GetRPOrowptrMin (int i)
 {
   return rporowMin_ptr[i];
@@ -1192,7 +1618,7 @@ short*
 **                Road-Pixel-Only row array for the maximum column with a road
 **                pixel in the row. The argument is the row number.
 */
-short*
+int*
   mem_GetRPOrowptrMax (int i)
 {
   return rporowMax_ptr[i];
@@ -1227,12 +1653,149 @@ int*
 **                Road-Pixel-Only column array for the index passed as a
 **                parameter.
 */
-short*
+int*
   mem_GetRPOcolptr (int i)
 {
   return rpocol_ptr[i];
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetRPOnearptr
+** PURPOSE:       return a pointer to the nearest-road index of a road grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Returns a pointer to the nearest-road run array of the
+**                road grid passed as a parameter: for each run of
+**                pixels along a row, the linear offset of the road
+**                pixel spr_road_search picks (-1 if there is none), or
+**                -2 - start for a run whose answer depends on the band
+**                (see mem_GetRPOnearListptr).
+*/
+int*
+  mem_GetRPOnearptr (int i)
+{
+  return rponear_ptr[i];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetRPOnearColptr
+** PURPOSE:       return a pointer to the nearest-road run start columns
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Returns a pointer to the array holding the first column
+**                of each nearest-road run of the road grid passed as a
+**                parameter.
+*/
+int*
+  mem_GetRPOnearColptr (int i)
+{
+  return rponearCol_ptr[i];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetRPOnearIdxptr
+** PURPOSE:       return a pointer to the nearest-road row index
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Returns a pointer to the nrows + 1 array holding, for
+**                each row of the road grid passed as a parameter, the
+**                index of its first nearest-road run; the runs of row r
+**                end where those of row r + 1 begin.
+*/
+int*
+  mem_GetRPOnearIdxptr (int i)
+{
+  return rponearIdx_ptr[i];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetRPOnearListptr
+** PURPOSE:       return a pointer to the nearest-road candidate lists
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Returns a pointer to the (offset, radius) pairs of the
+**                road grid passed as a parameter that a run value of
+**                -2 - start points into; see spr_rpoNearest.
+*/
+int*
+  mem_GetRPOnearListptr (int i)
+{
+  return rponearList_ptr[i];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetRPOnodeOffptr
+** PURPOSE:       return a pointer to the road-graph node offset array
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Road-graph nodes are the road pixels of a road grid in
+**                RPO column-array order. Returns the array of their
+**                linear offsets for the index passed as a parameter.
+*/
+int*
+  mem_GetRPOnodeOffptr (int i)
+{
+  return rponodeOff_ptr[i];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetRPOnodeNbrptr
+** PURPOSE:       return a pointer to the road-graph neighbor array
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Eight entries per node: the node reached in each
+**                util_get_next_neighbor direction (valid where the
+**                node's mask bit is set).
+*/
+int*
+  mem_GetRPOnodeNbrptr (int i)
+{
+  return rponodeNbr_ptr[i];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetRPOnodeMaskptr
+** PURPOSE:       return a pointer to the road-graph neighbor mask array
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Bit k of a node's mask is set when its neighbor in
+**                util_get_next_neighbor direction k is a road pixel.
+*/
+unsigned char*
+  mem_GetRPOnodeMaskptr (int i)
+{
+  return rponodeMask_ptr[i];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetRPOnodeValptr
+** PURPOSE:       return a pointer to the road-graph road value array
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   The road grid value of each node.
+*/
+PIXEL*
+  mem_GetRPOnodeValptr (int i)
+{
+  return rponodeVal_ptr[i];
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: mem_AllocateRPOcol
@@ -1252,12 +1815,44 @@ void
   
  char func[] = "mem_AllocateRPOcol";
  int i;
+ int nodes;
 
   bytes2allocateRPOcol = 0;
   for (i=0; i<scen_GetRoadDataFileCount(); i++)
      {
-      bytes2allocateRPOcol = (igrid_GetIGridRoadPixelCountByIndex(i) + 20) * sizeof(short);
+      bytes2allocateRPOcol = (igrid_GetIGridRoadPixelCountByIndex(i) + 20) * sizeof(int);
       rpocol_ptr[i] = malloc(bytes2allocateRPOcol);
+      rponear_ptr[i] = NULL;
+      rponearCol_ptr[i] = NULL;
+      rponearList_ptr[i] = NULL;
+      if (rpocol_ptr[i] == NULL)
+         {
+          sprintf (msg_buf, "Unable to allocate %lu bytes of memory (RPO col)",
+                   (unsigned long) (bytes2allocateRPOcol));
+          LOG_ERROR (msg_buf);
+          EXIT (1);
+         }
+      /* The 20 spare entries can be read when a year reuses another road */
+      /* grid's row counts (see spr_spread), so they must read as zero    */
+      /* rather than as whatever the heap held.                           */
+      memset (rpocol_ptr[i], 0, bytes2allocateRPOcol);
+
+      /* One road-graph node per RPO column entry. */
+      nodes = igrid_GetIGridRoadPixelCountByIndex(i) + 20;
+      rponodeOff_ptr[i]  = malloc(nodes * sizeof(int));
+      rponodeNbr_ptr[i]  = malloc(nodes * 8 * sizeof(int));
+      rponodeMask_ptr[i] = malloc(nodes * sizeof(unsigned char));
+      rponodeVal_ptr[i]  = malloc(nodes * sizeof(PIXEL));
+      if (rponodeOff_ptr[i]  == NULL ||
+          rponodeNbr_ptr[i]  == NULL ||
+          rponodeMask_ptr[i] == NULL ||
+          rponodeVal_ptr[i]  == NULL)
+         {
+          sprintf (msg_buf, "Unable to allocate %lu bytes of memory (RPO node)",
+                   (unsigned long) (nodes * (9 * sizeof(int) + sizeof(unsigned char) + sizeof(PIXEL))));
+          LOG_ERROR (msg_buf);
+          EXIT (1);
+         }
      }
 
 /**  D.D. Code added August 1, 2006                                          ***/
@@ -1267,36 +1862,74 @@ void
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: mem_GetGRZrowptr
-** PURPOSE:       Return a pointer to the brief cumulative growth row array
-** AUTHOR:        David I. Donato
-** PROGRAMMER:    David I. Donato
-** CREATION DATE: 08/17/2006
-** DESCRIPTION:   
-**                
-**                
+** FUNCTION NAME: mem_AllocateRPOnear
+** PURPOSE:       allocate memory for the nearest-road runs of a road grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   (Re)allocates the run value and run column arrays of
+**                road grid i to hold runs entries, and its candidate
+**                lists to hold entries ints. The counts are only known
+**                once spr_rpoNearest has swept the grid, and they
+**                change when the index is rebuilt for other row counts.
 */
-short*
-  mem_GetGRZrowptr()
+void
+  mem_AllocateRPOnear (int i,                                /* IN     */
+                       int runs,                             /* IN     */
+                       int entries)                          /* IN     */
 {
-  return z_row_ptr;
-}
+  char func[] = "mem_AllocateRPOnear";
+  int *val;
+  int *col;
+  int *list;
 
-/******************************************************************************
-*******************************************************************************
-** FUNCTION NAME: mem_GetGRZcolptr
-** PURPOSE:       Return a pointer to the brief cumulative growth column array
-** AUTHOR:        David I. Donato
+  val = realloc (rponear_ptr[i], runs * sizeof (int));
+  if (val != NULL)
+  {
+    rponear_ptr[i] = val;
+  }
+  col = realloc (rponearCol_ptr[i], runs * sizeof (int));
+  if (col != NULL)
+  {
+    rponearCol_ptr[i] = col;
+  }
+  list = realloc (rponearList_ptr[i], MAX (entries, 1) * sizeof (int));
+  if (list != NULL)
+  {
+    rponearList_ptr[i] = list;
+  }
+  if (val == NULL || col == NULL || list == NULL)
+  {
+    sprintf (msg_buf, "Unable to allocate %lu bytes of memory (RPO near)",
+             (unsigned long) ((2 * runs + entries) * sizeof (int)));
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  if (scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    fprintf (scen_GetLogFP (), "%s %d Allocated %lu bytes of memory (RPO near)\n",
+             __FILE__, __LINE__, (unsigned long) ((2 * runs + entries) * sizeof (int)));
+    scen_CloseLog ();
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetGRZoffptr
+** PURPOSE:       Return a pointer to the brief cumulative growth array
+** AUTHOR:        David I. Donato
 ** PROGRAMMER:    David I. Donato
 ** CREATION DATE: 08/17/2006
 ** DESCRIPTION:   
-**                
-**                
+**                10/17/2026 (SLEUTH-3r maintainers): one int offset per
+**                pixel replaces the short row and column arrays.
+**
 */
-short*
-  mem_GetGRZcolptr()
+int*
+  mem_GetGRZoffptr()
 {
-  return z_col_ptr;
+  return z_off_ptr;
 }
 
 /******************************************************************************
@@ -1367,3 +2000,496 @@ GRID_P
   return zgrwthpointer;
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetNbrCountPtr
+** PURPOSE:       return a pointer to the urban neighbor count grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   For each pixel, the number of its eight neighbors that
+**                are urban in the z grid. NULL unless the scenario sets
+**                NEIGHBOR_COUNT_GRID(YES/NO)=YES.
+**
+*/
+GRID_P
+  mem_GetNbrCountPtr()
+{
+  return nbrcount_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetFRNoffptr
+** PURPOSE:       Return a pointer to the urban frontier array
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless ORGANIC_FRONTIER(NO/YES/LEGACY)=YES.
+**                Holds pixel offsets.
+**
+*/
+int*
+  mem_GetFRNoffptr()
+{
+  return f_off_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetFRNcount
+** PURPOSE:       Return the number of pixels in the urban frontier arrays
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+int
+  mem_GetFRNcount()
+{
+  return frontiercount;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_SetFRNcount
+** PURPOSE:       Set the number of pixels in the urban frontier arrays
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  mem_SetFRNcount(int frontier_count)
+{
+  frontiercount = frontier_count;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetEligiblePtr
+** PURPOSE:       Return a pointer to the eligible cell index
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless ELIGIBLE_CELL_SAMPLING(YES/NO)=YES.
+**
+**
+*/
+int*
+  mem_GetEligiblePtr()
+{
+  return elig_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetEligiblePosPtr
+** PURPOSE:       Return a pointer to the eligible cell positions
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless ELIGIBLE_CELL_SAMPLING(YES/NO)=YES.
+**
+**
+*/
+int*
+  mem_GetEligiblePosPtr()
+{
+  return eligpos_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetEligibleCount
+** PURPOSE:       Return the number of pixels in the eligible cell index
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+int
+  mem_GetEligibleCount()
+{
+  return eligcount;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_SetEligibleCount
+** PURPOSE:       Set the number of pixels in the eligible cell index
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  mem_SetEligibleCount(int eligible_count)
+{
+  eligcount = eligible_count;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetActivePtr
+** PURPOSE:       Return a pointer to the active domain
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless ACTIVE_DOMAIN(YES/NO)=YES. Entry k is the
+**                offset of active pixel k; offsets ascend.
+**
+*/
+int*
+  mem_GetActivePtr()
+{
+  return active_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetActiveCount
+** PURPOSE:       Return the number of pixels in the active domain
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+int
+  mem_GetActiveCount()
+{
+  return activecount;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_SetActiveCount
+** PURPOSE:       Set the number of pixels in the active domain
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  mem_SetActiveCount(int active_count)
+{
+  activecount = active_count;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetActiveWindow
+** PURPOSE:       Return the rows and cols bounding the active domain
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   The whole image unless ACTIVE_DOMAIN(YES/NO)=YES, and
+**                then the smallest window holding every active pixel.
+**                Z and the urban input grids are zero outside it.
+**
+*/
+void
+  mem_GetActiveWindow(int *first_row,                        /* OUT    */
+                      int *last_row,                         /* OUT    */
+                      int *first_col,                        /* OUT    */
+                      int *last_col)                         /* OUT    */
+{
+  *first_row = activewindow[0];
+  *last_row = activewindow[1];
+  *first_col = activewindow[2];
+  *last_col = activewindow[3];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_SetActiveWindow
+** PURPOSE:       Set the rows and cols bounding the active domain
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  mem_SetActiveWindow(int first_row,                         /* IN     */
+                      int last_row,                          /* IN     */
+                      int first_col,                         /* IN     */
+                      int last_col)                          /* IN     */
+{
+  activewindow[0] = first_row;
+  activewindow[1] = last_row;
+  activewindow[2] = first_col;
+  activewindow[3] = last_col;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetAcceptGridPtr
+** PURPOSE:       Return a pointer to the fused acceptance grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless FUSED_ACCEPTANCE_GRID(YES/NO)=YES.
+**
+**
+*/
+unsigned short*
+  mem_GetAcceptGridPtr()
+{
+  return accept_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetZMaskPtr
+** PURPOSE:       Return a pointer to the bit mask of z
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless URBAN_BIT_MASKS(YES/NO)=YES.
+**
+**
+*/
+MASK_WORD*
+  mem_GetZMaskPtr()
+{
+  return zmask_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetSpreadMaskPtr
+** PURPOSE:       Return a pointer to the phase 4 candidate bit mask
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless URBAN_BIT_MASKS(YES/NO)=YES.
+**
+**
+*/
+MASK_WORD*
+  mem_GetSpreadMaskPtr()
+{
+  return spreadmask_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetUrbanMaskPtr
+** PURPOSE:       Return a pointer to the bit mask of urban input grid i
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless URBAN_BIT_MASKS(YES/NO)=YES. The caller
+**                fills the mask the first time it is used.
+**
+*/
+MASK_WORD*
+  mem_GetUrbanMaskPtr(int i)
+{
+  if (urbmask_ptr == NULL)
+  {
+    return NULL;
+  }
+  return urbmask_ptr + i * mask_words;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetClaimPtr
+** PURPOSE:       Return a pointer to the phase 4 claim grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless PARALLEL_ORGANIC_GROWTH(YES/NO)=YES. Every
+**                entry is -1 between uses.
+**
+*/
+int*
+  mem_GetClaimPtr()
+{
+  return claim_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetCandidatePtr
+** PURPOSE:       Return a pointer to the phase 4 attempt outcomes
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless PARALLEL_ORGANIC_GROWTH(YES/NO)=YES.
+**
+**
+*/
+int*
+  mem_GetCandidatePtr()
+{
+  return cand_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetReplicaZPtr
+** PURPOSE:       Return a pointer to the bit-sliced z grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless BIT_SLICED_REPLICAS(YES/NO)=YES. Bit k of
+**                word i is set when pixel i is urban in replica k.
+**
+*/
+MASK_WORD*
+  mem_GetReplicaZPtr()
+{
+  return repz_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetReplicaDeltaPtr
+** PURPOSE:       Return a pointer to the bit-sliced delta grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless BIT_SLICED_REPLICAS(YES/NO)=YES. Every
+**                word is 0 between years.
+**
+*/
+MASK_WORD*
+  mem_GetReplicaDeltaPtr()
+{
+  return repdelta_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetReplicaWorkPtr
+** PURPOSE:       Return a pointer to the bit-sliced scratch grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless BIT_SLICED_REPLICAS(YES/NO)=YES. Every
+**                word is 0 between uses.
+**
+*/
+MASK_WORD*
+  mem_GetReplicaWorkPtr()
+{
+  return repwork_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetReplicaZListPtr
+** PURPOSE:       Return a pointer to the replica urban list
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless BIT_SLICED_REPLICAS(YES/NO)=YES. The
+**                offsets of the pixels urban in any replica.
+**
+*/
+int*
+  mem_GetReplicaZListPtr()
+{
+  return repzlist_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetReplicaZCount
+** PURPOSE:       Return the length of the replica urban list
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+int
+  mem_GetReplicaZCount()
+{
+  return repzcount;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_SetReplicaZCount
+** PURPOSE:       Set the length of the replica urban list
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  mem_SetReplicaZCount(int replica_z_count)
+{
+  repzcount = replica_z_count;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetReplicaGrowthListPtr
+** PURPOSE:       Return a pointer to the replica growth list
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless BIT_SLICED_REPLICAS(YES/NO)=YES. The
+**                offsets of the pixels any replica grew this year.
+**
+*/
+int*
+  mem_GetReplicaGrowthListPtr()
+{
+  return repglist_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetReplicaSpreadListPtr
+** PURPOSE:       Return a pointer to the replica phase 4 list
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless BIT_SLICED_REPLICAS(YES/NO)=YES. The
+**                pixels that may spread in some replica.
+**
+*/
+int*
+  mem_GetReplicaSpreadListPtr()
+{
+  return repslist_ptr;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: mem_GetReplicaLaneListPtr
+** PURPOSE:       Return a pointer to a list for one replica
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NULL unless BIT_SLICED_REPLICAS(YES/NO)=YES. Scratch,
+**                one pixel offset per pixel.
+**
+*/
+int*
+  mem_GetReplicaLaneListPtr()
+{
+  return replane_ptr;
+}
@@ -17,10 +17,11 @@
 #include "ugm_typedefs.h"
 
 void mem_Init();
+void mem_ThreadInit();
 void mem_MemoryLog(FILE* fp);
 
 void mem_LogPartition(FILE* fp);
-int mem_GetPackedBytesPerGrid();
+size_t mem_GetPackedBytesPerGrid();
 GRID_P mem_GetIGridPtr( char* owner );
 
 GRID_P mem_GetPGridPtr( char* owner );
@@ -29,13 +30,17 @@ GRID_P mem_GetWGridPtr( char* module, char* who, int line );
 
 GRID_P mem_GetWGridFree( char* module, char* who, int line,GRID_P ptr );
 
-int mem_GetTotalPixels();
+void* mem_CountGridAlloc( size_t num_bytes );
+
+void mem_CountGridFree( void* ptr, size_t num_bytes );
+
+int mem_GetTotalPixels();  /* at most INT_MAX, see mem_Init */
 
 void mem_CheckMemory(FILE* fp,char* module, char* function, int line);
 
 void mem_ReinvalidateMemory();
 
-int memGetBytesPerGridRound();
+size_t memGetBytesPerGridRound();
 
 void mem_LogMinFreeWGrids(FILE* fp);
 FILE* mem_GetLogFP();
@@ -43,26 +48,62 @@ void mem_CloseLog();
 
 /* D.D. Added for growth Row and Column (GRC) arrays - July 28, 2006 */
 /* D.D. Return type changed to short August 10, 2006                 */
-short *mem_GetGRCrowptr ();
-short *mem_GetGRCcolptr ();
+/* Now one int offset per pixel - 10/17/2026                         */
+int   *mem_GetGRCoffptr ();
 
 /* D.D. Added for cumulative growth array - 8/17/2006                */
-short *mem_GetGRZrowptr ();
-short *mem_GetGRZcolptr ();
+int   *mem_GetGRZoffptr ();
 int    mem_GetGRZcount ();
 void   mem_SetGRZcount (int);
 GRID_P mem_GetGRZpointer();
 void   mem_SetGRZpointer(GRID_P);
+GRID_P mem_GetNbrCountPtr();
+int   *mem_GetFRNoffptr ();
+int    mem_GetFRNcount ();
+void   mem_SetFRNcount (int);
+int   *mem_GetEligiblePtr ();
+int   *mem_GetEligiblePosPtr ();
+int    mem_GetEligibleCount ();
+void   mem_SetEligibleCount (int);
+int   *mem_GetActivePtr ();
+int    mem_GetActiveCount ();
+void   mem_SetActiveCount (int);
+void   mem_GetActiveWindow (int *, int *, int *, int *);
+void   mem_SetActiveWindow (int, int, int, int);
+unsigned short *mem_GetAcceptGridPtr ();
+MASK_WORD *mem_GetZMaskPtr ();
+MASK_WORD *mem_GetSpreadMaskPtr ();
+MASK_WORD *mem_GetUrbanMaskPtr (int i);
+int   *mem_GetClaimPtr ();
+int   *mem_GetCandidatePtr ();
+MASK_WORD *mem_GetReplicaZPtr ();
+MASK_WORD *mem_GetReplicaDeltaPtr ();
+MASK_WORD *mem_GetReplicaWorkPtr ();
+int   *mem_GetReplicaZListPtr ();
+int    mem_GetReplicaZCount ();
+void   mem_SetReplicaZCount (int);
+int   *mem_GetReplicaGrowthListPtr ();
+int   *mem_GetReplicaSpreadListPtr ();
+int   *mem_GetReplicaLaneListPtr ();
 /* D.D. Added for cumulative growth array - 8/17/2006                */
 
-short *mem_GetRPOrowptrNum (int i);
-short *mem_GetRPOrowptrMin (int i);
-short *mem_GetRPOrowptrMax (int i);
+int   *mem_GetRPOrowptrNum (int i);
+int   *mem_GetRPOrowptrMin (int i);
+int   *mem_GetRPOrowptrMax (int i);
 int   *mem_GetRPOrowptrIdx (int i);
-short *mem_GetRPOcolptr (int i);
+int   *mem_GetRPOcolptr (int i);
+int   *mem_GetRPOnearptr (int i);
+int   *mem_GetRPOnearColptr (int i);
+int   *mem_GetRPOnearIdxptr (int i);
+int   *mem_GetRPOnearListptr (int i);
+int   *mem_GetRPOnodeOffptr (int i);
+int   *mem_GetRPOnodeNbrptr (int i);
+unsigned char *mem_GetRPOnodeMaskptr (int i);
+PIXEL *mem_GetRPOnodeValptr (int i);
 /**  D.D.  July 28, 2006                                   *******************/
 
 /**  D.D.  Added for road-pixel-only (RPO) column arrays - Aug. 1, 2006    ***/
 void mem_AllocateRPOcol();
+void mem_AllocateRPOnear (int i, int runs, int entries);
 /**  D.D.  Aug. 1, 2006                                                    ***/
 
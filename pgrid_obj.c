@@ -35,6 +35,9 @@ static grid_info delta;
 static grid_info land1;
 static grid_info land2;
 static grid_info cumulate;
+#ifdef _OPENMP
+#pragma omp threadprivate (z, deltatron, delta, land1, land2)
+#endif
 
 /******************************************************************************
 *******************************************************************************
@@ -99,6 +102,36 @@ void
   cumulate.ptr = mem_GetPGridPtr (func);
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: pgrid_ThreadInit
+** PURPOSE:       give the calling thread its own working p type grids
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                pgrid_Init for a thread of a PARALLEL_MONTE_CARLO
+**                pool, after mem_ThreadInit; the cumulate grid stays
+**                the master's. Does nothing for the master, or for a
+**                thread that has them already.
+**
+*/
+void
+  pgrid_ThreadInit ()
+{
+  char func[] = "pgrid_ThreadInit";
+
+  if (z.ptr != NULL)
+  {
+    return;
+  }
+  z.ptr = mem_GetPGridPtr (func);
+  deltatron.ptr = mem_GetPGridPtr (func);
+  delta.ptr = mem_GetPGridPtr (func);
+  land1.ptr = mem_GetPGridPtr (func);
+  land2.ptr = mem_GetPGridPtr (func);
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: pgrid_GetZPtr
@@ -1,6 +1,7 @@
 void pgrid_MemoryLog(FILE* fp);
 int pgrid_GetPGridCount();
 void pgrid_Init();
+void pgrid_ThreadInit();
 GRID_P pgrid_GetZPtr();
 GRID_P pgrid_GetDeltatronPtr();
 GRID_P pgrid_GetDeltaPtr();
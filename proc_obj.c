@@ -32,6 +32,9 @@ static int stop_year;
 static BOOLEAN restart_flag;
 static BOOLEAN last_run_flag;
 static BOOLEAN last_mc_flag;
+#ifdef _OPENMP
+#pragma omp threadprivate (current_monte_carlo, current_year, last_mc_flag)
+#endif
 
 /******************************************************************************
 *******************************************************************************
@@ -486,6 +489,26 @@ int
   return (current_run);
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: proc_ThreadInit
+** PURPOSE:       start a PARALLEL_MONTE_CARLO thread with the master's
+**                last monte carlo flag
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The flag is set once the last iteration starts; each
+**                thread keeps its own, so the iterations still growing
+**                alongside the last one do not see it.
+**
+*/
+void
+  proc_ThreadInit (BOOLEAN master_last_mc_flag)             /* IN     */
+{
+  last_mc_flag = master_last_mc_flag;
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: proc_SetLastMonteCarloFlag
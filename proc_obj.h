@@ -19,6 +19,7 @@ void proc_SetLastMonteCarlo(int val);
 
 int proc_IncrementCurrentRun();
 int proc_SetLastMonteCarloFlag();
+void proc_ThreadInit (BOOLEAN master_last_mc_flag);
 int proc_IncrementCurrentYear();
 void proc_SetNumRunsExecThisCPU (int val);
 int proc_GetNumRunsExecThisCPU ();
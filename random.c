@@ -2,11 +2,69 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <assert.h>
 #include "igrid_obj.h"
 #include "landclass_obj.h"
 #include "globals.h"
 #include "random.h"
 #include "ugm_macros.h"
+#include "scenario_obj.h"
+#include "proc_obj.h"
+
+/*****************************************************************************\
+*******************************************************************************
+**                                                                           **
+**                                 MACROS                                    **
+**                                                                           **
+*******************************************************************************
+\*****************************************************************************/
+#define RAN_IA 16807
+#define RAN_IM 2147483647
+#define RAN_IQ 127773
+#define RAN_IR 2836
+#define RAN_NDIV (1 + (RAN_IM - 1) / RAN_NTAB)
+#define RAN_AM (1.0 / RAN_IM)
+#define RAN_RNMX (1.0 - 1.2e-7)
+
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+#define RAN_2POW32_INV (1.0 / 4294967296.0)
+#define RAN_BATCH_BLOCKS (RAN_BATCH_WORDS / 4)
+
+/*****************************************************************************\
+*******************************************************************************
+**                                                                           **
+**                      STATIC MEMORY FOR THIS OBJECT                        **
+**                                                                           **
+*******************************************************************************
+\*****************************************************************************/
+static ran_stream_t main_stream;
+static ran_stream_t compat_stream;
+static RANDOM_SEED_TYPE main_seed;
+static int main_run;
+static int main_monte_carlo;
+/* the main stream's engine, the same for every thread */
+static int main_engine;
+#ifdef _OPENMP
+#pragma omp threadprivate (main_stream, compat_stream, main_monte_carlo)
+#endif
+
+/*****************************************************************************\
+*******************************************************************************
+**                                                                           **
+**                        STATIC FUNCTION PROTOTYPES                         **
+**                                                                           **
+*******************************************************************************
+\*****************************************************************************/
+static double ran_legacy (ran_stream_t * stream);
+static void ran_philox_batch (ran_stream_t * stream);
+static void ran_philox_block (unsigned int *key,
+                              unsigned int *counter,
+                              unsigned int *words);
 
 /*****************************************************************************\
 *******************************************************************************
@@ -22,73 +80,611 @@ char random_c_sccs_id[] = "@(#)random.c	1.230	12/4/00";
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: ran_random
-** PURPOSE:       generate random number
+** FUNCTION NAME: ran_legacy
+** PURPOSE:       generate random number from a legacy stream
 ** AUTHOR:        Keith Clarke
 ** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
 ** CREATION DATE: 11/11/1999
 ** DESCRIPTION:
-**
+**                Numerical Recipes ran1. The shuffle table and seed
+**                live in the stream so the sequence is the one
+**                ran_random has always produced, without any state
+**                shared between streams.
 **
 */
-double
-  ran_random (RANDOM_SEED_TYPE * ran_idum)
+static double
+  ran_legacy (ran_stream_t * stream)
 {
-  char func[] = "ran_random";
   int j;
-  int k;
-  static RANDOM_SEED_TYPE iv[32];
-  static RANDOM_SEED_TYPE iy;
+  RANDOM_SEED_TYPE k;
   double temp;
-  double random_num;
 
-  FUNC_INIT;
-  if ((*ran_idum) <= 0 || !iy)
+  if (stream->idum <= 0 || !stream->iy)
   {
-    if (-(*ran_idum) < 1)
+    if (-(stream->idum) < 1)
     {
-      (*ran_idum) = 1;
+      stream->idum = 1;
     }
     else
     {
-      (*ran_idum) = -(*ran_idum);
+      stream->idum = -(stream->idum);
     }
-    for (j = 32 + 7; j >= 0; j--)
+    for (j = RAN_NTAB + 7; j >= 0; j--)
     {
-      k = (*ran_idum) / 127773;
-      (*ran_idum) = 16807 * ((*ran_idum) - k * 127773) - 2836 * k;
-      if ((*ran_idum) < 0)
+      k = stream->idum / RAN_IQ;
+      stream->idum = RAN_IA * (stream->idum - k * RAN_IQ) - RAN_IR * k;
+      if (stream->idum < 0)
       {
-        (*ran_idum) += 2147483647;
+        stream->idum += RAN_IM;
       }
-      if (j < 32)
+      if (j < RAN_NTAB)
       {
-        iv[j] = (*ran_idum);
+        stream->iv[j] = stream->idum;
       }
     }
-    iy = iv[0];
+    stream->iy = stream->iv[0];
+  }
+  k = stream->idum / RAN_IQ;
+  stream->idum = RAN_IA * (stream->idum - k * RAN_IQ) - RAN_IR * k;
+  if (stream->idum < 0)
+  {
+    stream->idum += RAN_IM;
+  }
+  j = stream->iy / RAN_NDIV;
+  stream->iy = stream->iv[j];
+  stream->iv[j] = stream->idum;
+  if ((temp = RAN_AM * stream->iy) > RAN_RNMX)
+  {
+    return RAN_RNMX;
+  }
+  return temp;
+}
+/* (C) Copr. 1986-92 Numerical Recipes Software '%12'%. */
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_philox_batch
+** PURPOSE:       refill the buffer of a counter based stream
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Philox4x32-10 (Salmon et al., SC11). Each block is a
+**                pure function of the key and its counter, so the
+**                RAN_BATCH_BLOCKS blocks are run through the rounds
+**                side by side; the inner loops have no dependences
+**                and vectorize. Block b of the buffer is the block
+**                for counter + b, so the words come out in the same
+**                order as generating one block at a time.
+**
+*/
+static void
+  ran_philox_batch (ran_stream_t * stream)
+{
+  unsigned int c0[RAN_BATCH_BLOCKS];
+  unsigned int c1[RAN_BATCH_BLOCKS];
+  unsigned int c2[RAN_BATCH_BLOCKS];
+  unsigned int c3[RAN_BATCH_BLOCKS];
+  unsigned long long p0;
+  unsigned long long p1;
+  unsigned int k0;
+  unsigned int k1;
+  unsigned int lo;
+  unsigned int hi;
+  int round;
+  int b;
+
+  lo = stream->counter[0];
+  hi = stream->counter[1];
+  for (b = 0; b < RAN_BATCH_BLOCKS; b++)
+  {
+    c0[b] = lo + (unsigned int) b;
+    c1[b] = hi + (c0[b] < lo);
+    c2[b] = stream->counter[2];
+    c3[b] = stream->counter[3];
+  }
+
+  k0 = stream->key[0];
+  k1 = stream->key[1];
+  for (round = 0; round < PHILOX_ROUNDS; round++)
+  {
+    for (b = 0; b < RAN_BATCH_BLOCKS; b++)
+    {
+      p0 = (unsigned long long) PHILOX_M0 * c0[b];
+      p1 = (unsigned long long) PHILOX_M1 * c2[b];
+      c0[b] = (unsigned int) (p1 >> 32) ^ c1[b] ^ k0;
+      c2[b] = (unsigned int) (p0 >> 32) ^ c3[b] ^ k1;
+      c1[b] = (unsigned int) p1;
+      c3[b] = (unsigned int) p0;
+    }
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
   }
-  k = (*ran_idum) / 127773;
-  (*ran_idum) = 16807 * ((*ran_idum) - k * 127773) - 2836 * k;
-  if ((*ran_idum) < 0)
+
+  for (b = 0; b < RAN_BATCH_BLOCKS; b++)
   {
-    (*ran_idum) += 2147483647;
+    stream->buffer[4 * b] = c0[b];
+    stream->buffer[4 * b + 1] = c1[b];
+    stream->buffer[4 * b + 2] = c2[b];
+    stream->buffer[4 * b + 3] = c3[b];
   }
-  j = iy / (1 + (2147483647 - 1) / 32);
-  iy = iv[j];
-  iv[j] = (*ran_idum);
-  if ((temp = (1.0 / 2147483647) * iy) > (1.0 - 1.2e-7))
+  stream->buffer_index = 0;
+
+  stream->counter[0] = lo + RAN_BATCH_BLOCKS;
+  if (stream->counter[0] < lo)
   {
-    random_num = 1.0 - 1.2e-7;
+    stream->counter[1]++;
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_philox_block
+** PURPOSE:       generate one Philox4x32-10 block
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The rounds of ran_philox_batch for a single counter,
+**                with no stream state, so any thread may call it.
+**
+*/
+static void
+  ran_philox_block (unsigned int *key,                       /* IN     */
+                    unsigned int *counter,                   /* IN     */
+                    unsigned int *words)                     /* OUT    */
+{
+  unsigned long long p0;
+  unsigned long long p1;
+  unsigned int c0;
+  unsigned int c1;
+  unsigned int c2;
+  unsigned int c3;
+  unsigned int k0;
+  unsigned int k1;
+  int round;
+
+  c0 = counter[0];
+  c1 = counter[1];
+  c2 = counter[2];
+  c3 = counter[3];
+  k0 = key[0];
+  k1 = key[1];
+  for (round = 0; round < PHILOX_ROUNDS; round++)
+  {
+    p0 = (unsigned long long) PHILOX_M0 * c0;
+    p1 = (unsigned long long) PHILOX_M1 * c2;
+    c0 = (unsigned int) (p1 >> 32) ^ c1 ^ k0;
+    c2 = (unsigned int) (p0 >> 32) ^ c3 ^ k1;
+    c1 = (unsigned int) p1;
+    c3 = (unsigned int) p0;
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+  words[0] = c0;
+  words[1] = c1;
+  words[2] = c2;
+  words[3] = c3;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_StreamSeed
+** PURPOSE:       initialize a random number stream
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                A legacy stream is seeded exactly as InitRandom
+**                always seeded ran_random (run, monte_carlo and
+**                substream are ignored). A counter stream is keyed by
+**                (seed, run) and starts at block zero of the
+**                (monte_carlo, substream) counter space.
+**
+*/
+void
+  ran_StreamSeed (ran_stream_t * stream,                     /* OUT    */
+                  int engine,                                /* IN     */
+                  RANDOM_SEED_TYPE seed,                     /* IN     */
+                  int run,                                   /* IN     */
+                  int monte_carlo,                           /* IN     */
+                  int substream)                           /* IN     */
+{
+  char func[] = "ran_StreamSeed";
+
+  FUNC_INIT;
+  assert (stream != NULL);
+
+  memset ((void *) stream, 0, sizeof (ran_stream_t));
+  stream->engine = engine;
+  switch (engine)
+  {
+  case RANDOM_ENGINE_LEGACY:
+    stream->idum = -labs (seed);
+    break;
+  case RANDOM_ENGINE_COUNTER:
+    stream->key[0] = (unsigned int) labs (seed);
+    stream->key[1] = (unsigned int) run;
+    stream->counter[2] = (unsigned int) monte_carlo;
+    stream->counter[3] = (unsigned int) substream;
+    stream->buffer_index = RAN_BATCH_WORDS;
+    break;
+  default:
+    sprintf (msg_buf, "Unknown random number engine = %d", engine);
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_Word32
+** PURPOSE:       return the next 32 bit random word of a stream
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+unsigned int
+  ran_Word32 (ran_stream_t * stream)
+{
+  if (stream->engine == RANDOM_ENGINE_LEGACY)
+  {
+    return (unsigned int) (ran_legacy (stream) * 4294967296.0);
+  }
+  if (stream->buffer_index >= RAN_BATCH_WORDS)
+  {
+    ran_philox_batch (stream);
+  }
+  return stream->buffer[stream->buffer_index++];
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_Uniform
+** PURPOSE:       return the next uniform deviate of a stream
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Deviates lie in the open interval (0,1) for both
+**                engines. This is called for every draw, so it does
+**                not push the call stack.
+**
+*/
+double
+  ran_Uniform (ran_stream_t * stream)
+{
+  if (stream->engine == RANDOM_ENGINE_LEGACY)
+  {
+    return ran_legacy (stream);
+  }
+  if (stream->buffer_index >= RAN_BATCH_WORDS)
+  {
+    ran_philox_batch (stream);
+  }
+  return ((double) stream->buffer[stream->buffer_index++] + 0.5) *
+    RAN_2POW32_INV;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_Bounded
+** PURPOSE:       return the next random integer in [0,n) of a stream
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The legacy engine truncates deviate * n, exactly as
+**                RANDOM_INT always has. The counter engine maps a 32
+**                bit word to [0,n) with a multiply and shift and
+**                rejects the few words that would bias the result
+**                (Lemire, ACM TOMACS 2019), so no floating point is
+**                involved and every value is equally likely.
+**
+*/
+int
+  ran_Bounded (ran_stream_t * stream,                        /* IN/OUT */
+               int n)                                        /* IN     */
+{
+  unsigned long long m;
+  unsigned int low;
+  unsigned int bound;
+
+  assert (n > 0);
+  if (stream->engine == RANDOM_ENGINE_LEGACY)
+  {
+    return (int) (ran_legacy (stream) * n);
+  }
+  bound = (unsigned int) n;
+  m = (unsigned long long) ran_Word32 (stream) * bound;
+  low = (unsigned int) m;
+  if (low < bound)
+  {
+    unsigned int reject = (0U - bound) % bound;
+
+    while (low < reject)
+    {
+      m = (unsigned long long) ran_Word32 (stream) * bound;
+      low = (unsigned int) m;
+    }
+  }
+  return (int) (m >> 32);
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_SetThreshold
+** PURPOSE:       precompute a threshold for ran_Exceeds
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                A counter deviate (w + 0.5) / 2^32 exceeds value
+**                exactly when w > value * 2^32 - 0.5; both sides are
+**                exact in double precision, so words counts the
+**                words that do not exceed it.
+**
+*/
+void
+  ran_SetThreshold (ran_threshold_t * threshold,             /* OUT    */
+                    double value)                            /* IN     */
+{
+  double limit;
+
+  threshold->value = value;
+  limit = value * 4294967296.0 - 0.5;
+  if (limit < 0.0)
+  {
+    threshold->words = 0;
+  }
+  else if (limit >= 4294967295.0)
+  {
+    threshold->words = 4294967296ULL;
   }
   else
   {
-    random_num = temp;
+    threshold->words = (unsigned long long) limit + 1;
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_Exceeds
+** PURPOSE:       test whether the next deviate exceeds a threshold
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Same result as RANDOM_FLOAT > threshold->value, one
+**                draw either way; the counter engine compares the raw
+**                word against the precomputed count.
+**
+*/
+int
+  ran_Exceeds (ran_stream_t * stream,                        /* IN/OUT */
+               ran_threshold_t * threshold)                  /* IN     */
+{
+  if (stream->engine == RANDOM_ENGINE_LEGACY)
+  {
+    return ran_legacy (stream) > threshold->value;
   }
+  return (unsigned long long) ran_Word32 (stream) >= threshold->words;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_GetStream
+** PURPOSE:       return the stream RANNUM draws from
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+ran_stream_t *
+  ran_GetStream ()
+{
+  return ran_stream;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_SetStream
+** PURPOSE:       set the stream RANNUM draws from
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                NULL restores the main stream seeded by InitRandom.
+**
+*/
+void
+  ran_SetStream (ran_stream_t * stream)
+{
+  ran_stream = (stream != NULL) ? stream : &main_stream;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_GetEngine
+** PURPOSE:       return the engine of the main stream
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+int
+  ran_GetEngine ()
+{
+  return main_engine;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_GetMonteCarlo
+** PURPOSE:       return the monte carlo iteration the keyed draws use
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The calling thread's iteration, for loops that hand
+**                keyed draws to other threads with ran_ReplicaBlock.
+**
+*/
+int
+  ran_GetMonteCarlo ()
+{
+  return main_monte_carlo;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_KeyedBlock
+** PURPOSE:       return the four random words keyed to one index
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                One Philox4x32-10 block keyed by (seed, run) at
+**                counter (index, year, monte carlo, substream). The
+**                words depend on nothing else, so threads may draw
+**                for different indices in any order and get the same
+**                answers. Substream 0 belongs to the counter engine's
+**                main stream, so callers use RAN_SUBSTREAM_* values.
+**                Used with either engine.
+**
+*/
+void
+  ran_KeyedBlock (int substream,                             /* IN     */
+                  int year,                                  /* IN     */
+                  int index,                                 /* IN     */
+                  unsigned int *words)                       /* OUT    */
+{
+  ran_ReplicaBlock (substream, year, index, main_monte_carlo, words);
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_KeyedStream
+** PURPOSE:       start a counter stream keyed to one index
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                For draws that need more than one ran_KeyedBlock. The
+**                stream is keyed by (seed, run) and runs through the
+**                blocks of counter (block, index, monte carlo,
+**                year * 256 + substream), so like ran_KeyedBlock it
+**                depends only on its arguments. Does not push the call
+**                stack, so threads may seed their own streams.
+**
+*/
+void
+  ran_KeyedStream (ran_stream_t * stream,                    /* OUT    */
+                   int substream,                            /* IN     */
+                   int year,                                 /* IN     */
+                   int index)                                /* IN     */
+{
+  ran_ReplicaStream (stream, substream, year, index, main_monte_carlo);
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_ReplicaBlock
+** PURPOSE:       return the four random words keyed to one index of
+**                any monte carlo iteration
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                ran_KeyedBlock for iteration monte_carlo rather than
+**                the one ran_SeedMonteCarlo last set, so the replicas
+**                of BIT_SLICED_REPLICAS each draw what their own
+**                iteration would.
+**
+*/
+void
+  ran_ReplicaBlock (int substream,                           /* IN     */
+                    int year,                                /* IN     */
+                    int index,                               /* IN     */
+                    int monte_carlo,                         /* IN     */
+                    unsigned int *words)                     /* OUT    */
+{
+  unsigned int key[2];
+  unsigned int counter[4];
+
+  key[0] = (unsigned int) labs (main_seed);
+  key[1] = (unsigned int) main_run;
+  counter[0] = (unsigned int) index;
+  counter[1] = (unsigned int) year;
+  counter[2] = (unsigned int) monte_carlo;
+  counter[3] = (unsigned int) substream;
+  ran_philox_block (key, counter, words);
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_ReplicaStream
+** PURPOSE:       start a counter stream keyed to one index of any
+**                monte carlo iteration
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                ran_KeyedStream for iteration monte_carlo.
+**
+*/
+void
+  ran_ReplicaStream (ran_stream_t * stream,                  /* OUT    */
+                     int substream,                          /* IN     */
+                     int year,                               /* IN     */
+                     int index,                              /* IN     */
+                     int monte_carlo)                        /* IN     */
+{
+  stream->engine = RANDOM_ENGINE_COUNTER;
+  stream->key[0] = (unsigned int) labs (main_seed);
+  stream->key[1] = (unsigned int) main_run;
+  stream->counter[0] = 0;
+  stream->counter[1] = (unsigned int) index;
+  stream->counter[2] = (unsigned int) monte_carlo;
+  stream->counter[3] = (unsigned int) year * 256 + (unsigned int) substream;
+  stream->buffer_index = RAN_BATCH_WORDS;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_random
+** PURPOSE:       generate random number
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                Original seed-pointer interface, kept for callers
+**                outside the stream API. It draws from a private
+**                legacy stream.
+**
+*/
+double
+  ran_random (RANDOM_SEED_TYPE * ran_idum)
+{
+  char func[] = "ran_random";
+  double random_num;
+
+  FUNC_INIT;
+  compat_stream.engine = RANDOM_ENGINE_LEGACY;
+  compat_stream.idum = (*ran_idum);
+  random_num = ran_legacy (&compat_stream);
+  (*ran_idum) = compat_stream.idum;
   FUNC_END;
   return random_num;
 }
-/* (C) Copr. 1986-92 Numerical Recipes Software '%12'%. */
 
 
 /******************************************************************************
@@ -99,7 +695,8 @@ double
 ** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
 ** CREATION DATE: 11/11/1999
 ** DESCRIPTION:
-**
+**                Seeds the main stream for the current run using the
+**                scenario's RANDOM_ENGINE.
 **
 */
 void
@@ -107,7 +704,44 @@ void
 {
   char func[] = "InitRandom";
   FUNC_INIT;
+  main_seed = seed;
+  main_run = proc_GetCurrentRun ();
+  main_monte_carlo = 0;
+  main_engine = scen_GetRandomEngine ();
   ran_seed = -labs (seed);
+  ran_StreamSeed (&main_stream, scen_GetRandomEngine (), seed,
+                  proc_GetCurrentRun (), 0, 0);
+  ran_stream = &main_stream;
   RANNUM;
   FUNC_END;
 }
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: ran_SeedMonteCarlo
+** PURPOSE:       position the main stream at a monte carlo iteration
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The legacy engine runs one sequence through every
+**                iteration, so it is left alone. A counter stream is
+**                rekeyed so iteration monte_carlo draws the same
+**                numbers no matter which iterations ran before it.
+**
+*/
+void
+  ran_SeedMonteCarlo (int monte_carlo)
+{
+  char func[] = "ran_SeedMonteCarlo";
+
+  FUNC_INIT;
+  main_monte_carlo = monte_carlo;
+  if (main_engine == RANDOM_ENGINE_COUNTER)
+  {
+    ran_StreamSeed (&main_stream, RANDOM_ENGINE_COUNTER, main_seed,
+                    proc_GetCurrentRun (), monte_carlo, 0);
+  }
+  ran_stream = &main_stream;
+  FUNC_END;
+}
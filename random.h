@@ -1,35 +1,145 @@
 #ifndef RANDOM_H
 #define RANDOM_H
 
+/*
+ *
+ * RANDOM NUMBER ENGINES
+ *
+ * RANDOM_ENGINE_LEGACY  - Numerical Recipes ran1 (shuffled Park-Miller).
+ *                         Reproduces the historical SLEUTH sequence
+ *                         bit for bit; one sequence runs through all
+ *                         monte carlo iterations of a run.
+ * RANDOM_ENGINE_COUNTER - Philox4x32-10 counter based generator. Each
+ *                         stream is keyed by (seed, run, monte carlo,
+ *                         substream) so any stream may be generated
+ *                         independently of every other stream.
+ *
+ */
+#define RANDOM_ENGINE_LEGACY  0
+#define RANDOM_ENGINE_COUNTER 1
+#define RAN_NTAB 32
+#define RAN_BATCH_WORDS 32
+
+/*
+ *
+ * KEYED SUBSTREAMS (ran_KeyedBlock)
+ *
+ */
+#define RAN_SUBSTREAM_PHASE4 1
+#define RAN_SUBSTREAM_PHASE1N3 2
+#define RAN_SUBSTREAM_PHASE5 3
+
+/*
+ *
+ * MAP A RANDOM WORD TO [0,n) WITH A MULTIPLY AND SHIFT; THE BIAS IS
+ * AT MOST n IN 2^32
+ *
+ */
+#define RAN_WORD_BOUNDED(w,n) \
+        ((int) (((unsigned long long) (w) * (unsigned int) (n)) >> 32))
+
+typedef struct
+{
+  int engine;
+  /* RANDOM_ENGINE_LEGACY state */
+  RANDOM_SEED_TYPE idum;
+  RANDOM_SEED_TYPE iy;
+  RANDOM_SEED_TYPE iv[RAN_NTAB];
+  /* RANDOM_ENGINE_COUNTER state */
+  unsigned int key[2];
+  unsigned int counter[4];
+  unsigned int buffer[RAN_BATCH_WORDS];
+  int buffer_index;
+} ran_stream_t;
+
+/*
+ *
+ * PRECOMPUTED THRESHOLD
+ *
+ * ran_Exceeds (stream, &t) returns the same answer as
+ * RANDOM_FLOAT > t.value without converting the draw to a double
+ * on the counter engine; words is the number of 32 bit words whose
+ * deviate does not exceed value.
+ *
+ */
+typedef struct
+{
+  double value;
+  unsigned long long words;
+} ran_threshold_t;
+
 #ifdef RANDOM_MODULE
   /* stuff visable only to the random module */
 char random_h_sccs_id[] = "@(#)random.h	1.230	12/4/00";
 
   RANDOM_SEED_TYPE   ran_seed;
   int    glb_random_count;
+  ran_stream_t *ran_stream;
+#ifdef _OPENMP
+#pragma omp threadprivate (ran_stream)
+#endif
 
 #else
 
   extern RANDOM_SEED_TYPE   ran_seed;
   extern int    glb_random_count;
+  extern ran_stream_t *ran_stream;
+#ifdef _OPENMP
+#pragma omp threadprivate (ran_stream)
+#endif
 
 #endif
 /* #defines visable to any module including this header file*/
 
 
 #if 1
-#define RANNUM ran_random(&ran_seed)
+#define RANNUM ran_Uniform(ran_stream)
 #else
+#define RANNUM ran_random(&ran_seed)
 #endif
 
 
 /* reassign random numbers */
-#define RANDOM_ROW  ((int)  (RANNUM * igrid_GetNumRows()))
-#define RANDOM_COL  ((int)  (RANNUM * igrid_GetNumCols()))
-#define RANDOM_INT(a)  ((int)  (RANNUM * (a)))
+#define RANDOM_ROW  (ran_Bounded (ran_stream, igrid_GetNumRows()))
+#define RANDOM_COL  (ran_Bounded (ran_stream, igrid_GetNumCols()))
+#define RANDOM_INT(a)  (ran_Bounded (ran_stream, (a)))
 #define RANDOM_FLOAT  (RANNUM)
 
 
 double ran_random(RANDOM_SEED_TYPE*);
 void  InitRandom (RANDOM_SEED_TYPE);
+void  ran_SeedMonteCarlo (int monte_carlo);
+void  ran_StreamSeed (ran_stream_t* stream,
+                      int engine,
+                      RANDOM_SEED_TYPE seed,
+                      int run,
+                      int monte_carlo,
+                      int substream);
+double ran_Uniform (ran_stream_t* stream);
+unsigned int ran_Word32 (ran_stream_t* stream);
+int   ran_Bounded (ran_stream_t* stream, int n);
+void  ran_SetThreshold (ran_threshold_t* threshold, double value);
+int   ran_Exceeds (ran_stream_t* stream, ran_threshold_t* threshold);
+ran_stream_t* ran_GetStream ();
+void  ran_SetStream (ran_stream_t* stream);
+int   ran_GetEngine ();
+int   ran_GetMonteCarlo ();
+void  ran_KeyedBlock (int substream,
+                      int year,
+                      int index,
+                      unsigned int* words);
+void  ran_KeyedStream (ran_stream_t* stream,
+                       int substream,
+                       int year,
+                       int index);
+void  ran_ReplicaBlock (int substream,
+                        int year,
+                        int index,
+                        int monte_carlo,
+                        unsigned int* words);
+void  ran_ReplicaStream (ran_stream_t* stream,
+                         int substream,
+                         int year,
+                         int index,
+                         int monte_carlo);
 #endif
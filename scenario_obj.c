@@ -57,6 +57,8 @@ code access to its data values through its member functions.
 #include "proc_obj.h"
 #include "ugm_macros.h"
 #include "wgrid_obj.h"
+#include "random.h"
+#include "spread.h"
 
 
 
@@ -98,6 +100,13 @@ char scenario_obj_c_sccs_id[] = "@(#)scenario_obj.c	1.84	12/4/00";
 static scenario_info scenario;
 static char log_filename[SCEN_MAX_FILENAME_LEN];
 
+/* log output scen_DeferLog holds back (PARALLEL_MONTE_CARLO) */
+static FILE *deferred_log;
+static BOOLEAN deferring_log;
+#ifdef _OPENMP
+#pragma omp threadprivate (deferred_log, deferring_log)
+#endif
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -159,6 +168,10 @@ char *
 FILE *
   scen_GetLogFP ()
 {
+  if (deferring_log)
+  {
+    return deferred_log;
+  }
   return scenario.log_fp;
 }
 
@@ -179,6 +192,11 @@ void
   char func[] = "scen_Append2Log";
   FUNC_INIT;
 
+  if (deferring_log)
+  {
+    FUNC_END;
+    return;
+  }
   if (scenario.log_fp == NULL)
   {
     FILE_OPEN (scenario.log_fp, log_filename, "a");
@@ -515,6 +533,23 @@ int
   return scenario.random_seed;
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetRandomEngine
+** PURPOSE:       return random number engine
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+int
+  scen_GetRandomEngine ()
+{
+  return scenario.random_engine;
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: scen_GetMonteCarloIterations
@@ -1701,6 +1736,261 @@ int
   return scenario.phase5g_growth_color;
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetNeighborCountGridFlag
+** PURPOSE:       return scenario.neighbor_count_grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetNeighborCountGridFlag ()
+{
+  return scenario.neighbor_count_grid;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetOrganicFrontier
+** PURPOSE:       return scenario.organic_frontier
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   One of the ORGANIC_FRONTIER settings in spread.h.
+**
+**
+*/
+int
+  scen_GetOrganicFrontier ()
+{
+  return scenario.organic_frontier;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetEligibleCellSamplingFlag
+** PURPOSE:       return scenario.eligible_cell_sampling
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetEligibleCellSamplingFlag ()
+{
+  return scenario.eligible_cell_sampling;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetFusedAcceptanceGridFlag
+** PURPOSE:       return scenario.fused_acceptance_grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetFusedAcceptanceGridFlag ()
+{
+  return scenario.fused_acceptance_grid;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetUrbanBitMasksFlag
+** PURPOSE:       return scenario.urban_bit_masks
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetUrbanBitMasksFlag ()
+{
+  return scenario.urban_bit_masks;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetParallelOrganicGrowthFlag
+** PURPOSE:       return scenario.parallel_organic_growth
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetParallelOrganicGrowthFlag ()
+{
+  return scenario.parallel_organic_growth;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetNumThreads
+** PURPOSE:       return scenario.num_threads
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   0 leaves the choice to the OpenMP runtime.
+**
+**
+*/
+int
+  scen_GetNumThreads ()
+{
+  return scenario.num_threads;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetParallelRandomGrowthFlag
+** PURPOSE:       return scenario.parallel_random_growth
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetParallelRandomGrowthFlag ()
+{
+  return scenario.parallel_random_growth;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetActiveDomainFlag
+** PURPOSE:       return scenario.active_domain
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetActiveDomainFlag ()
+{
+  return scenario.active_domain;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetBitSlicedReplicasFlag
+** PURPOSE:       return scenario.bit_sliced_replicas
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetBitSlicedReplicasFlag ()
+{
+  return scenario.bit_sliced_replicas;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetSkipEquivalentRunsFlag
+** PURPOSE:       return scenario.skip_equivalent_runs
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetSkipEquivalentRunsFlag ()
+{
+  return scenario.skip_equivalent_runs;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetParallelMonteCarloFlag
+** PURPOSE:       return scenario.parallel_monte_carlo
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetParallelMonteCarloFlag ()
+{
+  return scenario.parallel_monte_carlo;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_GetPipelinedStatsFlag
+** PURPOSE:       return scenario.pipelined_stats
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  scen_GetPipelinedStatsFlag ()
+{
+  return scenario.pipelined_stats;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: scen_DeferLog
+** PURPOSE:       hold back this thread's log output, or write it
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                While deferred, scen_Append2Log and scen_CloseLog do
+**                nothing and scen_GetLogFP returns a temporary file of
+**                the calling thread. Turning deferral off appends what
+**                the thread held back to the log.
+**
+*/
+void
+  scen_DeferLog (BOOLEAN defer)                              /* IN     */
+{
+  if (defer)
+  {
+    deferred_log = util_OpenDeferred (deferred_log);
+    deferring_log = TRUE;
+  }
+  else if (deferring_log)
+  {
+    deferring_log = FALSE;
+    if (ftell (deferred_log) > 0)
+    {
+      scen_Append2Log ();
+      util_FlushDeferred (deferred_log, scenario.log_fp);
+      scen_CloseLog ();
+    }
+  }
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: scen_init
@@ -2027,6 +2317,17 @@ static void
           util_trim (object_ptr);
           scenario.random_seed = atoi (object_ptr);
         }
+        else if (!strcmp (keyword, "RANDOM_ENGINE(LEGACY/COUNTER)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.random_engine = RANDOM_ENGINE_LEGACY;
+          if (!strcmp (object_ptr, "COUNTER"))
+          {
+            scenario.random_engine = RANDOM_ENGINE_COUNTER;
+          }
+        }
         else if (!strcmp (keyword, "NUM_WORKING_GRIDS"))
         {
           object_ptr = strtok (NULL, " \n");
@@ -2418,6 +2719,148 @@ static void
           scenario.deltatron_color[scenario.deltatron_color_count++] =
             scen_process_user_color (object_ptr);
         }
+        else if (!strcmp (keyword, "NEIGHBOR_COUNT_GRID(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.neighbor_count_grid = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.neighbor_count_grid = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "ORGANIC_FRONTIER(NO/YES/LEGACY)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.organic_frontier = ORGANIC_FRONTIER_OFF;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.organic_frontier = ORGANIC_FRONTIER_ON;
+          }
+          if (!strcmp (object_ptr, "LEGACY"))
+          {
+            scenario.organic_frontier = ORGANIC_FRONTIER_LEGACY;
+          }
+        }
+        else if (!strcmp (keyword, "ELIGIBLE_CELL_SAMPLING(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.eligible_cell_sampling = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.eligible_cell_sampling = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "FUSED_ACCEPTANCE_GRID(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.fused_acceptance_grid = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.fused_acceptance_grid = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "URBAN_BIT_MASKS(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.urban_bit_masks = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.urban_bit_masks = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "PARALLEL_ORGANIC_GROWTH(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.parallel_organic_growth = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.parallel_organic_growth = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "NUM_THREADS"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          scenario.num_threads = atoi (object_ptr);
+        }
+        else if (!strcmp (keyword, "PARALLEL_RANDOM_GROWTH(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.parallel_random_growth = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.parallel_random_growth = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "ACTIVE_DOMAIN(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.active_domain = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.active_domain = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "BIT_SLICED_REPLICAS(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.bit_sliced_replicas = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.bit_sliced_replicas = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "SKIP_EQUIVALENT_RUNS(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.skip_equivalent_runs = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.skip_equivalent_runs = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "PARALLEL_MONTE_CARLO(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.parallel_monte_carlo = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.parallel_monte_carlo = TRUE;
+          }
+        }
+        else if (!strcmp (keyword, "PIPELINED_STATS(YES/NO)"))
+        {
+          object_ptr = strtok (NULL, " \n");
+          util_trim (object_ptr);
+          util_AllCAPS (object_ptr);
+          scenario.pipelined_stats = FALSE;
+          if (!strcmp (object_ptr, "YES"))
+          {
+            scenario.pipelined_stats = TRUE;
+          }
+        }
 
 		/*VerD*/
 
@@ -2578,6 +3021,7 @@ void
   fprintf (fp, "scenario.log_processing_status = %u\n",
            scenario.log_processing_status);
   fprintf (fp, "scenario.random_seed = %u\n", scenario.random_seed);
+  fprintf (fp, "scenario.random_engine = %u\n", scenario.random_engine);
   fprintf (fp, "scenario.num_working_grids = %d\n", scenario.num_working_grids);
   fprintf (fp, "scenario.monte_carlo_iterations = %u\n",
            scenario.monte_carlo_iterations);
@@ -2707,6 +3151,32 @@ void
     fprintf (fp, "scenario.deltatron_color[%u] = %u\n",
              index, scenario.deltatron_color[index]);
   }
+  fprintf (fp, "scenario.neighbor_count_grid = %u\n",
+           scenario.neighbor_count_grid);
+  fprintf (fp, "scenario.organic_frontier = %u\n",
+           scenario.organic_frontier);
+  fprintf (fp, "scenario.eligible_cell_sampling = %u\n",
+           scenario.eligible_cell_sampling);
+  fprintf (fp, "scenario.fused_acceptance_grid = %u\n",
+           scenario.fused_acceptance_grid);
+  fprintf (fp, "scenario.urban_bit_masks = %u\n",
+           scenario.urban_bit_masks);
+  fprintf (fp, "scenario.parallel_organic_growth = %u\n",
+           scenario.parallel_organic_growth);
+  fprintf (fp, "scenario.num_threads = %d\n",
+           scenario.num_threads);
+  fprintf (fp, "scenario.parallel_random_growth = %u\n",
+           scenario.parallel_random_growth);
+  fprintf (fp, "scenario.active_domain = %u\n",
+           scenario.active_domain);
+  fprintf (fp, "scenario.bit_sliced_replicas = %u\n",
+           scenario.bit_sliced_replicas);
+  fprintf (fp, "scenario.skip_equivalent_runs = %u\n",
+           scenario.skip_equivalent_runs);
+  fprintf (fp, "scenario.parallel_monte_carlo = %u\n",
+           scenario.parallel_monte_carlo);
+  fprintf (fp, "scenario.pipelined_stats = %u\n",
+           scenario.pipelined_stats);
 
   FUNC_END;
 }
@@ -2728,6 +3198,11 @@ void
   char func[] = "scen_CloseLog";
   FUNC_INIT;
 
+  if (deferring_log)
+  {
+    FUNC_END;
+    return;
+  }
   if (scenario.log_fp)
   {
     fclose (scenario.log_fp);
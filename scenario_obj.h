@@ -57,6 +57,7 @@ typedef struct
   BOOLEAN logging;
   BOOLEAN postprocessing;
   int random_seed;
+  int random_engine;
   int num_working_grids;
   int monte_carlo_iterations;
   coeff_int_info start;
@@ -109,6 +110,19 @@ typedef struct
   print_window_t deltatron_aging_window;
   int deltatron_color[256];
   int deltatron_color_count;
+  BOOLEAN neighbor_count_grid;
+  int organic_frontier;
+  BOOLEAN eligible_cell_sampling;
+  BOOLEAN fused_acceptance_grid;
+  BOOLEAN urban_bit_masks;
+  BOOLEAN parallel_organic_growth;
+  int num_threads;
+  BOOLEAN parallel_random_growth;
+  BOOLEAN active_domain;
+  BOOLEAN bit_sliced_replicas;
+  BOOLEAN skip_equivalent_runs;
+  BOOLEAN parallel_monte_carlo;
+  BOOLEAN pipelined_stats;
 } scenario_info;
 #endif
 
@@ -137,6 +151,21 @@ BOOLEAN scen_GetEchoFlag();
 BOOLEAN scen_GetLogFlag();
 BOOLEAN scen_GetPostprocessingFlag();
 int   scen_GetRandomSeed();
+int   scen_GetRandomEngine();
+BOOLEAN scen_GetNeighborCountGridFlag();
+int   scen_GetOrganicFrontier();
+BOOLEAN scen_GetEligibleCellSamplingFlag();
+BOOLEAN scen_GetFusedAcceptanceGridFlag();
+BOOLEAN scen_GetUrbanBitMasksFlag();
+BOOLEAN scen_GetParallelOrganicGrowthFlag();
+int   scen_GetNumThreads();
+BOOLEAN scen_GetParallelRandomGrowthFlag();
+BOOLEAN scen_GetActiveDomainFlag();
+BOOLEAN scen_GetBitSlicedReplicasFlag();
+BOOLEAN scen_GetSkipEquivalentRunsFlag();
+BOOLEAN scen_GetParallelMonteCarloFlag();
+BOOLEAN scen_GetPipelinedStatsFlag();
+void  scen_DeferLog(BOOLEAN defer);
 int   scen_GetMonteCarloIterations();
 int   scen_GetCoeffDiffusionStart();
 int   scen_GetCoeffBreedStart();
@@ -0,0 +1,780 @@
+/*******************************************************************************
+
+  MODULE:                   sleuth.c
+
+  CONTAINING SYSTEM:        SLEUTH-3r (based on SLEUTH Model 3.0 Beta)
+                            (Slope, Land-cover, Exclusion, Urbanization, 
+                            Transportation, and Hillshade)
+                            also known as UGM 3.0 Beta (for Urban Growth Model)
+
+  VERSION:                  SLEUTH-3r [Includes Version D features]
+
+  REVISION DATE:            October 17, 2026
+
+  PURPOSE:
+
+     This module is the interface of libsleuth.a. sleuth_Load reads
+     a scenario and its input grids once, sleuth_Run runs the model
+     (drv_driver) for one set of coefficients, as often as wanted,
+     and sleuth_Finish gathers the per-process output files. main.c
+     drives these functions from the command line.
+
+  NOTES:
+
+     The model keeps its state in the static memory of each object
+     module, and nothing resets the caches built from a scenario (the
+     road search structures, the urban masks, the stored runs of
+     SKIP_EQUIVALENT_RUNS), so there is one model per process:
+     sleuth_Load is called once, and its runs are made one after the
+     other. sleuth_Run writes the same output files as a calibration
+     run of the grow binary, and errors still end the process through
+     EXIT.
+
+  MODIFICATIONS:
+
+  TO DO:
+
+**************************************************************************/
+
+#define MAIN_MODULE
+#define SLEUTH_MODULE
+#ifdef MPI
+#include <mpi.h>
+#endif
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include "coeff_obj.h"
+#include "igrid_obj.h"
+#include "landclass_obj.h"
+#include "globals.h"
+#include "output.h"
+#include "utilities.h"
+#include "random.h"
+#include "driver.h"
+#include "input.h"
+#include "scenario_obj.h"
+#include "proc_obj.h"
+#include "timer_obj.h"
+#include "pgrid_obj.h"
+#include "color_obj.h"
+#include "memory_obj.h"
+#include "stats_obj.h"
+#include "transition_obj.h"
+#include "ugm_macros.h"
+#include "sleuth.h"
+
+/*****************************************************************************\
+*******************************************************************************
+**                                                                           **
+**                        STATIC FUNCTION PROTOTYPES                         **
+**                                                                           **
+*******************************************************************************
+\*****************************************************************************/
+static BOOLEAN sleuth_my_run ();
+
+/*****************************************************************************\
+*******************************************************************************
+**                                                                           **
+**                      STATIC MEMORY FOR THIS OBJECT                        **
+**                                                                           **
+*******************************************************************************
+\*****************************************************************************/
+static int restart_run;
+static BOOLEAN loaded = FALSE;
+
+/*VerD*/
+
+FILE *fpVerD2;
+FILE *fpVerD3;
+FILE *fpVerD4;
+
+double aux_diffusion_coeff  = - 1.0f;
+double aux_breed_coeff      = - 1.0f;
+double aux_diffusion_mult   = 0.005f;
+
+BOOLEAN WriteSlopeFileFlag    = 0;
+BOOLEAN WriteRatioFileFlag    = 0;
+BOOLEAN WriteXypointsFileFlag = 0;
+
+/*VerD*/
+
+/* Variable added for load balancing - D. Donato - 6/5/2006 */
+
+int redistributedloadcount=0;
+
+/* Variable added for load balancing - D. Donato - 6/5/2006 */
+
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: sleuth_Load
+** PURPOSE:       read a scenario and set up the model to run it
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Everything the grow binary does before its first run:
+**                reads the scenario file and the input grids, sets up
+**                memory, the landuse classes and the transition matrix,
+**                computes the base statistics and creates the output
+**                files. processing_type is CALIBRATING, TESTING or
+**                PREDICTING; restart continues a calibration from
+**                RESTART_FILE. Called once per process; a second call
+**                is an error, as the object modules keep what the
+**                first loaded. Under MPI, after MPI_Init.
+**
+*/
+void
+  sleuth_Load (int processing_type,                          /* IN     */
+               BOOLEAN restart,                              /* IN     */
+               char *scenario_file)                          /* IN     */
+{
+  char func[] = "sleuth_Load";
+  char fname[MAX_FILENAME_LEN];
+  RANDOM_SEED_TYPE random_seed;
+  int restart_diffusion;
+  int restart_breed;
+  int restart_spread;
+  int restart_slope_resistance;
+  int restart_road_gravity;
+  time_t tp;
+  char processing_str[MAX_FILENAME_LEN];
+  int i;
+
+  if (loaded)
+  {
+    sprintf (msg_buf, "sleuth_Load may only be called once per process");
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  loaded = TRUE;
+
+#ifndef MPI
+  glb_mype = 0;
+  glb_npes = 1;
+#endif
+
+  timer_Init ();
+  timer_Start (TOTAL_TIME);
+
+  FUNC_INIT;
+
+  proc_SetProcessingType (processing_type);
+  proc_SetRestartFlag (restart);
+  if (processing_type == PREDICTING)
+  {
+    strcpy (processing_str, "PREDICTING");
+  }
+  else if (processing_type == TESTING)
+  {
+    strcpy (processing_str, "TESTING");
+  }
+  else if (restart)
+  {
+    strcpy (processing_str, "restart CALIBRATING");
+  }
+  else
+  {
+    strcpy (processing_str, "CALIBRATING");
+  }
+  scen_init (scenario_file);
+
+
+  /*
+   *
+   * SET SOME VARIABLES
+   *
+   */
+  random_seed = scen_GetRandomSeed ();
+
+/*
+ * void landclassSetGrayscale (int index, int val);
+ * void landclassSetColor (int index, int val);
+ * void landclassSetType (int index, char* string);
+ * void landclassSetName (int index, char* string);
+ * void landclassSetNumClasses (int val);
+ * int scen_GetNumLanduseClasses ();
+ * char* scen_GetLanduseClassName (int);
+ * char* scen_GetLanduseClassType (int);
+ * int scen_GetLanduseClassColor (int);
+ * int scen_GetLanduseClassGrayscale (int i);
+ * 
+ */
+  landclassSetNumClasses (scen_GetNumLanduseClasses ());
+  for (i = 0; i < scen_GetNumLanduseClasses (); i++)
+  {
+    landclassSetGrayscale (i, scen_GetLanduseClassGrayscale (i));
+    landclassSetName (i, scen_GetLanduseClassName (i));
+    landclassSetType (i, scen_GetLanduseClassType (i));
+    landclassSetColor (i, scen_GetLanduseClassColor (i));
+  }
+
+  /*
+   *
+   * SET UP COEFFICIENTS
+   *
+   */
+  if (restart)
+  {
+    if (scen_GetLogFlag ())
+    {
+      scen_Append2Log ();
+      if (scen_GetLogFP ())
+      {
+        fprintf (scen_GetLogFP (), "%s %u Reading restart file\n",
+                 __FILE__, __LINE__);
+      }
+      scen_CloseLog ();
+    }
+    inp_read_restart_file (&restart_diffusion,
+                           &restart_breed,
+                           &restart_spread,
+                           &restart_slope_resistance,
+                           &restart_road_gravity,
+                           &random_seed,
+                           &restart_run);
+    proc_SetCurrentRun (restart_run);
+
+  }
+  else
+  {
+    proc_SetCurrentRun (0);
+  }
+  coeff_SetStartDiffusion (scen_GetCoeffDiffusionStart ());
+  coeff_SetStartSpread (scen_GetCoeffSpreadStart ());
+  coeff_SetStartBreed (scen_GetCoeffBreedStart ());
+  coeff_SetStartSlopeResist (scen_GetCoeffSlopeResistStart ());
+  coeff_SetStartRoadGravity (scen_GetCoeffRoadGravityStart ());
+
+  coeff_SetStopDiffusion (scen_GetCoeffDiffusionStop ());
+  coeff_SetStopSpread (scen_GetCoeffSpreadStop ());
+  coeff_SetStopBreed (scen_GetCoeffBreedStop ());
+  coeff_SetStopSlopeResist (scen_GetCoeffSlopeResistStop ());
+  coeff_SetStopRoadGravity (scen_GetCoeffRoadGravityStop ());
+
+  coeff_SetStepDiffusion (scen_GetCoeffDiffusionStep ());
+  coeff_SetStepSpread (scen_GetCoeffSpreadStep ());
+  coeff_SetStepBreed (scen_GetCoeffBreedStep ());
+  coeff_SetStepSlopeResist (scen_GetCoeffSlopeResistStep ());
+  coeff_SetStepRoadGravity (scen_GetCoeffRoadGravityStep ());
+
+  coeff_SetBestFitDiffusion (scen_GetCoeffDiffusionBestFit ());
+  coeff_SetBestFitSpread (scen_GetCoeffSpreadBestFit ());
+  coeff_SetBestFitBreed (scen_GetCoeffBreedBestFit ());
+  coeff_SetBestFitSlopeResist (scen_GetCoeffSlopeResistBestFit ());
+  coeff_SetBestFitRoadGravity (scen_GetCoeffRoadGravityBestFit ());
+
+  /*
+   *
+   * INITIALIZE IGRID
+   *
+   */
+  igrid_init ();
+
+  /*
+   *
+   * PRINT BANNER
+   *
+   */
+  if (scen_GetEchoFlag ())
+  {
+    out_banner (stdout);
+
+    /*VerD*/
+	fprintf(stdout,
+		"\n\nRunning SLEUTH-3r [August 31, 2006]\n\n");
+    /*VerD*/
+
+  }
+
+  if (scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    out_banner (scen_GetLogFP ());
+
+	/*VerD*/
+    fprintf(scen_GetLogFP (),
+		"\n\nRunning SLEUTH TEST VERSION 3.0(Rev. D-2.0) [August 31, 2006]\n\n");
+    /*VerD*/
+
+    scen_CloseLog ();
+  }
+
+  /*
+   *
+   * LOG SOME STUFF
+   *
+   */
+  if (scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    time (&tp);
+    fprintf (scen_GetLogFP (), "DATE OF RUN: %s\n",
+             asctime (localtime (&tp)));
+
+	/*VerD*/
+
+    if (proc_GetProcessingType () != PREDICTING)
+	{
+		if (WriteXypointsFileFlag == 1)
+		{
+			sprintf(fname,"%sxypoints_pe_%u.log",scen_GetOutputDir(), glb_mype);
+			fpVerD2 =fopen(fname, "w");
+			fprintf(fpVerD2," %%run      mc  diff breed spread slope road_grav year  area\n");
+		}
+
+		if (WriteSlopeFileFlag == 1)
+		{
+			sprintf(fname,"%sslope_pe_%u.log",scen_GetOutputDir(), glb_mype);
+			fpVerD3 =fopen(fname, "w");
+		}
+
+		if (WriteRatioFileFlag == 1)
+		{
+			sprintf(fname,"%sratio_pe_%u.log",scen_GetOutputDir(), glb_mype);
+			fpVerD4 =fopen(fname, "w");
+		}
+	}
+
+	/*VerD*/
+
+
+    fprintf (scen_GetLogFP (), "USER: %s\n", getenv ("USER"));
+    fprintf (scen_GetLogFP (), "HOST: %s\n", getenv ("HOST"));
+    fprintf (scen_GetLogFP (), "HOSTTYPE: %s\n", getenv ("HOSTTYPE"));
+    fprintf (scen_GetLogFP (), "OSTYPE: %s\n", getenv ("OSTYPE"));
+    fprintf (scen_GetLogFP (), "Type of architecture: %lu bit\n\n",
+             (unsigned long) (BYTES_PER_WORD*8));
+    fprintf (scen_GetLogFP (), "Number of CPUs %u \n\n",
+             glb_npes);
+    fprintf (scen_GetLogFP (), "PWD: %s\n", getenv ("PWD"));
+    fprintf (scen_GetLogFP (), "Scenario File: %s\n",
+             scen_GetScenarioFilename ());
+    fprintf (scen_GetLogFP (), "Type of Processing: %s\n",
+             processing_str);
+    fprintf (scen_GetLogFP (), "\n\n");
+
+    scen_echo (scen_GetLogFP ());
+    coeff_LogStart (scen_GetLogFP ());
+    coeff_LogStop (scen_GetLogFP ());
+    coeff_LogStep (scen_GetLogFP ());
+    coeff_LogBestFit (scen_GetLogFP ());
+    scen_CloseLog ();
+  }
+
+  /*
+   *
+   * SET UP FLAT MEMORY
+   *
+   */
+#ifdef MPI
+  MPI_Barrier (MPI_COMM_WORLD);
+#endif
+  mem_Init ();
+printf("\nIN MAIN - FINISHED MEM INITIALIZATION\n");
+  if (scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    mem_LogPartition (scen_GetLogFP ());
+    mem_CheckMemory (scen_GetLogFP (), __FILE__, func, __LINE__);
+    scen_CloseLog ();
+  }
+#ifdef MPI
+  MPI_Barrier (MPI_COMM_WORLD);
+#endif
+
+  /*
+   *
+   * INITIALIZE LANDUSE
+   *
+   */
+  if (scen_GetDoingLanduseFlag ())
+  {
+    landclass_Init ();
+    if (scen_GetLogLandclassSummaryFlag ())
+    {
+      if (scen_GetLogFlag ())
+      {
+        scen_Append2Log ();
+        landclass_LogIt (scen_GetLogFP ());
+        scen_CloseLog ();
+      }
+    }
+  }
+
+  /*
+   *
+   * INITIALIZE COLORTABLES
+   *
+   */
+  color_Init ();
+
+  /*
+   *
+   * WRITE MEMORY MAPS
+   *
+   */
+  if (scen_GetLogMemoryMapFlag ())
+  {
+    color_MemoryLog (mem_GetLogFP ());
+    coeff_MemoryLog (mem_GetLogFP ());
+    timer_MemoryLog (mem_GetLogFP ());
+    igrid_MemoryLog (mem_GetLogFP ());
+    pgrid_MemoryLog (mem_GetLogFP ());
+    stats_MemoryLog (mem_GetLogFP ());
+    mem_MemoryLog (mem_GetLogFP ());
+    proc_MemoryLog (mem_GetLogFP ());
+    landclass_MemoryLog (mem_GetLogFP ());
+    scen_MemoryLog (mem_GetLogFP ());
+    trans_MemoryLog (mem_GetLogFP ());
+    mem_CloseLog ();
+  }
+
+  /*
+   *
+   * READ INPUT DATA FILES
+   *
+   */
+  igrid_ReadFiles ();
+  if (scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    igrid_ValidateGrids (scen_GetLogFP ());
+    scen_CloseLog ();
+  }
+  else
+  {
+    igrid_ValidateGrids (NULL);
+  }
+  igrid_NormalizeRoads ();
+  if (scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    igrid_LogIt (scen_GetLogFP ());
+    igrid_VerifyInputs (scen_GetLogFP ());
+    scen_CloseLog ();
+  }
+  else
+  {
+    igrid_VerifyInputs (NULL);
+  }
+
+  /*
+   *
+   * INITIALIZE THE PGRID GRIDS
+   *
+   */
+  pgrid_Init ();
+
+  if (scen_GetLogFlag ())
+  {
+    if (scen_GetLogColortablesFlag ())
+    {
+      scen_Append2Log ();
+      color_LogIt (scen_GetLogFP ());
+      scen_CloseLog ();
+    }
+  }
+
+  /*
+   *
+   * COUNT THE NUMBER OF RUNS
+   *
+   */
+  proc_SetTotalRuns ();
+  if (scen_GetLogFlag ())
+  {
+    if (proc_GetProcessingType () == CALIBRATING)
+    {
+      scen_Append2Log ();
+      fprintf (scen_GetLogFP (), "%s %u Total Number of Runs = %u\n",
+               __FILE__, __LINE__, proc_GetTotalRuns ());
+      scen_CloseLog ();
+    }
+  }
+
+  proc_SetLastMonteCarlo (scen_GetMonteCarloIterations () - 1);
+  /*
+   *
+   * COMPUTE THE TRANSITION MATRIX
+   *
+   */
+  if (scen_GetDoingLanduseFlag ())
+  {
+    trans_Init ();
+    if (scen_GetLogFlag ())
+    {
+      if (scen_GetLogTransitionMatrixFlag ())
+      {
+        scen_Append2Log ();
+        trans_LogTransition (scen_GetLogFP ());
+        scen_CloseLog ();
+      }
+    }
+  }
+
+  /*** D. Donato August 16, 2006  Set up abbreviated data structures for ***
+   ***                            excluded and urban-seed pixels.        **/
+
+   igrid_BuildCompactExcPixFile();
+   igrid_BuildCompactUrbPixFile();
+   igrid_BuildActiveDomain();
+
+  /*
+   *
+   * COMPUTE THE BASE STATISTICS AGAINST WHICH CALIBRATION WILL TAKE PLACE
+   *
+   */
+  stats_Init ();
+  if (scen_GetLogFlag ())
+  {
+    if (scen_GetLogBaseStatsFlag ())
+    {
+      scen_Append2Log ();
+      stats_LogBaseStats (scen_GetLogFP ());
+      scen_CloseLog ();
+    }
+  }
+  if (scen_GetLogFlag ())
+  {
+    if (scen_GetLogDebugFlag ())
+    {
+      scen_Append2Log ();
+      igrid_Debug (scen_GetLogFP (), __FILE__, __LINE__);
+      scen_CloseLog ();
+    }
+  }
+
+  proc_SetNumRunsExecThisCPU (0);
+  if (proc_GetCurrentRun () == 0 && glb_mype == 0)
+  {
+    if (proc_GetProcessingType () != PREDICTING)
+    {
+      sprintf (fname, "%scontrol_stats.log", scen_GetOutputDir ());
+      stats_CreateControlFile (fname);
+    }
+    if (scen_GetWriteStdDevFileFlag ())
+    {
+      sprintf (fname, "%sstd_dev.log", scen_GetOutputDir ());
+      stats_CreateStatsValFile (fname);
+    }
+    if (scen_GetWriteAvgFileFlag ())
+    {
+      sprintf (fname, "%savg.log", scen_GetOutputDir ());
+      stats_CreateStatsValFile (fname);
+    }
+  }
+
+  coeff_CreateCoeffFile ();
+
+#ifdef MPI
+  MPI_Barrier (MPI_COMM_WORLD);
+#endif
+
+  if (proc_GetProcessingType () == PREDICTING)
+  {
+    proc_SetStopYear (scen_GetPredictionStopDate ());
+  }
+  else
+  {
+    proc_SetStopYear (igrid_GetUrbanYear (igrid_GetUrbanCount () - 1));
+  }
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: sleuth_Run
+** PURPOSE:       run the model for one set of coefficients
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                One run of a calibration or test, or the prediction,
+**                after sleuth_Load. The random numbers are seeded
+**                again, so the run does not depend on the runs made
+**                before it; with SKIP_EQUIVALENT_RUNS, though, a run
+**                equivalent to an earlier one is not grown, and its
+**                statistics are copied from that run instead (see
+**                drv_EquivalentRun). Unless predicting, the restart
+**                file is written first and, if control is not NULL
+**                and this process made the run, control gets what
+**                the run wrote to control_stats.log. Not re-entrant:
+**                runs share the model's static state (see sleuth.h).
+**
+*/
+void
+  sleuth_Run (int diffusion,                                 /* IN     */
+              int breed,                                     /* IN     */
+              int spread,                                    /* IN     */
+              int slope_resistance,                          /* IN     */
+              int road_gravity,                              /* IN     */
+              stats_control_t * control)                     /* OUT    */
+{
+  char func[] = "sleuth_Run";
+  char fname[MAX_FILENAME_LEN];
+
+  FUNC_INIT;
+  if (!loaded)
+  {
+    sprintf (msg_buf, "sleuth_Run called before sleuth_Load");
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  if (proc_GetProcessingType () != PREDICTING)
+  {
+    sprintf (fname, "%s%s%u", scen_GetOutputDir (),
+             RESTART_FILE, glb_mype);
+    out_write_restart_data (fname,
+                            diffusion,
+                            breed,
+                            spread,
+                            slope_resistance,
+                            road_gravity,
+                            scen_GetRandomSeed (),
+                            restart_run);
+    restart_run++;
+  }
+  InitRandom (scen_GetRandomSeed ());
+  coeff_SetCurrentDiffusion ((double) diffusion);
+  coeff_SetCurrentSpread ((double) spread);
+  coeff_SetCurrentBreed ((double) breed);
+  coeff_SetCurrentSlopeResist ((double) slope_resistance);
+  coeff_SetCurrentRoadGravity ((double) road_gravity);
+  if (sleuth_my_run ())
+  {
+    if ((proc_GetProcessingType () == PREDICTING) || !drv_EquivalentRun ())
+    {
+      drv_driver ();
+    }
+    proc_IncrementNumRunsExecThisCPU ();
+    if ((control != NULL) && (proc_GetProcessingType () != PREDICTING))
+    {
+      stats_GetControlStats (control);
+    }
+    if (scen_GetLogFlag ())
+    {
+      if (scen_GetLogTimingsFlag () > 1)
+      {
+        scen_Append2Log ();
+        timer_LogIt (scen_GetLogFP ());
+        scen_CloseLog ();
+      }
+    }
+  }
+  if (proc_GetProcessingType () != PREDICTING)
+  {
+    proc_IncrementCurrentRun ();
+  }
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: sleuth_Finish
+** PURPOSE:       gather the output files and close the log
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                After the last sleuth_Run. Process 0 concatenates the
+**                per-process coefficient, average, standard deviation
+**                and control statistics files; the total time is
+**                logged. Under MPI, call it after the last barrier.
+**
+*/
+void
+  sleuth_Finish ()
+{
+  char func[] = "sleuth_Finish";
+
+  FUNC_INIT;
+  if (glb_mype == 0)
+  {
+    if (scen_GetWriteCoeffFileFlag ())
+    {
+      coeff_ConcatenateFiles ();
+    }
+    if (scen_GetWriteAvgFileFlag ())
+    {
+      stats_ConcatenateAvgFiles ();
+    }
+    if (scen_GetWriteStdDevFileFlag ())
+    {
+      stats_ConcatenateStdDevFiles ();
+    }
+    if (proc_GetProcessingType () != PREDICTING)
+    {
+      stats_ConcatenateControlFiles ();
+    }
+  }
+  timer_Stop (TOTAL_TIME);
+  if (scen_GetLogFlag ())
+  {
+    scen_Append2Log ();
+    if (scen_GetLogTimingsFlag () > 0)
+    {
+      timer_LogIt (scen_GetLogFP ());
+    }
+    mem_LogMinFreeWGrids (scen_GetLogFP ());
+    drv_LogEquivalentRuns (scen_GetLogFP ());
+    scen_CloseLog ();
+  }
+  if (scen_GetEchoFlag ())
+  {
+    drv_LogEquivalentRuns (stdout);
+  }
+	 /*VerD*/
+     if (proc_GetProcessingType () != PREDICTING)
+	 {
+		if (WriteXypointsFileFlag == 1) fclose(fpVerD2);
+		if (WriteSlopeFileFlag == 1) fclose(fpVerD3);
+		if (WriteRatioFileFlag == 1) fclose(fpVerD4);
+	 }
+	 /*VerD*/
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: sleuth_my_run
+** PURPOSE:       tell if this process makes the current run
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Process 0 makes the prediction. Under MPI the runs of
+**                a calibration are dealt out as described below.
+**
+*/
+static BOOLEAN
+  sleuth_my_run ()
+{
+  if (proc_GetProcessingType () == PREDICTING)
+  {
+    return (glb_mype == 0);
+  }
+#ifdef MPI
+/*
+   The following "if" statement was modified to divide up runs for
+   process rank (glb_mpye) zero (0) across all process ranks. This
+   reduces the computational load on the console process which 
+   otherwise would take considerably longer to finish processing
+   than the other processes.
+   D. Donato - June 5, 2006
+*/
+  return (
+          (proc_GetCurrentRun () % glb_npes != 0 &&
+           proc_GetCurrentRun () % glb_npes == glb_mype)
+            ||
+          (proc_GetCurrentRun () % glb_npes == 0 &&
+           redistributedloadcount++ % glb_npes == glb_mype)
+         );
+#else
+  return TRUE;
+#endif
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+  INCLUDE-FILE NAME:        sleuth.h
+
+  CONTAINING SYSTEM:        SLEUTH-3r (based on SLEUTH Model 3.0 Beta)
+                            (Slope, Land-cover, Exclusion, Urbanization,
+                            Transportation, and Hillshade)
+                            also known as UGM 3.0 Beta (for Urban Growth Model)
+
+  VERSION:                  SLEUTH-3r [Includes Version D features]
+
+  PURPOSE:
+
+     The interface of libsleuth.a, for programs that load a scenario
+     once and run the model for many sets of coefficients. The grow
+     binary (main.c) is one such program.
+
+  NOTES:
+
+     The library is not re-entrant. There is no context object: the
+     scenario, the grids, the coefficients and the statistics live in
+     the static memory of the object modules, so a process holds one
+     loaded scenario, sleuth_Load is called once, and sleuth_Run calls
+     are made one after the other from one thread. Programs that need
+     several models at once run several processes.
+
+*******************************************************************************/
+
+#ifndef SLEUTH_H
+#define SLEUTH_H
+#include "ugm_defines.h"
+#include "stats_obj.h"
+
+#ifdef SLEUTH_MODULE
+  /* stuff visable only to the sleuth module */
+char sleuth_h_sccs_id[] = "@(#)sleuth.h	1.0	10/17/26";
+
+#endif
+
+/*
+ *
+ * FUNCTION PROTOTYPES
+ *
+ */
+void
+  sleuth_Load (int processing_type,                          /* IN     */
+               BOOLEAN restart,                              /* IN     */
+               char *scenario_file);                         /* IN     */
+
+void
+  sleuth_Run (int diffusion,                                 /* IN     */
+              int breed,                                     /* IN     */
+              int spread,                                    /* IN     */
+              int slope_resistance,                          /* IN     */
+              int road_gravity,                              /* IN     */
+              stats_control_t * control);                    /* OUT    */
+
+void
+  sleuth_Finish ();
+
+#endif
@@ -31,6 +31,9 @@
 #include <string.h>
 #include <math.h>
 #include <errno.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "igrid_obj.h"
 #include "landclass_obj.h"
 #include "globals.h"
@@ -44,6 +47,7 @@
 #include "proc_obj.h"
 #include "scenario_obj.h"
 #include "stats_obj.h"
+#include "spread.h"
 
 /*VerD*/
 extern float aux_diffusion_coeff;
@@ -64,6 +68,31 @@ float road_growth_diffusion_coefficient;
 #define SPREAD_MODULE
 #define SWGHT_TYPE float
 #define SLOPE_WEIGHT_ARRAY_SZ 256
+#define ACCEPT_SCALE 65535
+
+/* outcomes of a parallel phase 4 attempt other than a claimed pixel */
+#define P4_NO_ATTEMPT       -1
+#define P4_Z_FAILURE        -2
+#define P4_DELTA_FAILURE    -3
+#define P4_SLOPE_FAILURE    -4
+#define P4_EXCLUDED_FAILURE -5
+
+/* outcomes of a parallel trial's attempt (PARALLEL_RANDOM_GROWTH) */
+#define TRIAL_SUCCESS          0
+#define TRIAL_Z_FAILURE        1
+#define TRIAL_DELTA_FAILURE    2
+#define TRIAL_SLOPE_FAILURE    3
+#define TRIAL_EXCLUDED_FAILURE 4
+#define TRIAL_SLOTS            9   /* a phase 1 hit and 8 breed tries */
+
+/* one urbanization attempt of a parallel trial, applied later */
+typedef struct
+{
+  int offset;
+  PIXEL value;
+  int outcome;
+  int *stat;
+} spr_attempt_t;
 
 /***                          D.D. July 28, 2006               (Begin)     ***/
 #define WCOL(rr,kk)  rpocol_ptr[rporow_ptrIdx[rr]+kk]
@@ -71,6 +100,13 @@ float road_growth_diffusion_coefficient;
 #define MAXCOL(rr)   rpocol_ptr[rporow_ptrIdx[rr]+rporow_ptrNum[rr]-1]
 /*******************          D.D. July 28, 2006      (End)  ******************/
 
+/* TRUE if the road search prefers the road row row, val away at row */
+/* distance dist, to brow, bval away at bdist: the nearer, then the  */
+/* nearer row, then the row above.                                   */
+#define SPR_NEAR_BEFORE(val,dist,row,bval,bdist,brow)                     \
+        ((val) < (bval) || ((val) == (bval) && (dist) < (bdist)) ||       \
+         ((val) == (bval) && (dist) == (bdist) && (row) < (brow)))
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -88,32 +124,112 @@ float road_growth_diffusion_coefficient;
 /***                          D.D. July 28, 2006               (Begin)      **/
 /*** "int *" changed to "short *" 8/10/2006                                 **/
 /*** "short *" corrected back to "int *" for rporow_ptrIdx" 8/14/2006       **/
+/*** and back to "int *" for all of them, for wide grids 10/17/2026         **/
   static int rpoStatus[15];         /* Indicates whether RPO files have been created for this road grid. */
   static int rpoIndex;              /* Points to the RPO file-set in use. */
   static GRID_P rpoList[15];        /* Contains pointers to road grids. */
   static char rpoInitIndic={'n'};   /* Indicates whether the RPO files have been initialized */
-  static short *rporow_ptrNum;
-  static short *rporow_ptrMin;
-  static short *rporow_ptrMax;
+  static int   *rporow_ptrNum;
+  static int   *rporow_ptrMin;
+  static int   *rporow_ptrMax;
   static int   *rporow_ptrIdx;
-  static short *rpocol_ptr;
-  static int tfoundN, tfoundRow, tfoundCol;
-  static int  foundN,  foundRow,  foundCol;
+  static int   *rpocol_ptr;
+  static int   *rponear_ptr;          /* Nearest-road runs for the road grid in use. */
+  static int   *rponearCol;           /* First column of each run. */
+  static int   *rponearIdx;           /* First run of each row. */
+  static int   *rponearList;          /* Candidate lists of runs below -1. */
+  static int   *rponearNum[15];       /* rporow_ptrNum each index was built for. */
+  static int  bn_search_index = -1; /* max_search_index the cached bn was found for. */
+  static int  bn_cached;
+
+/* Road graph of the road grid in use (see spr_rpoGraph). Directions are */
+/* numbered as in util_get_next_neighbor.                                 */
+  static int   *rponodeOff;
+  static int   *rponodeNbr;
+  static unsigned char *rponodeMask;
+  static PIXEL *rponodeVal;
+  static int ring_row[8] = {-1, 0, 1, 1, 1, 0, -1, -1};
+  static int ring_col[8] = {-1, -1, -1, 0, 1, 1, 1, 0};
+  static signed char walk_turn[8][256]; /* first set bit of a mask at or after k */
 /*******************          D.D. July 28, 2006      (End)  ******************/
 
 /***  D. Donato  Aug. 14, 2006  Moved to module level from spr_phase5       **/
   static int    growth_count;
-  static short *growth_row;
-  static short *growth_col;
+  static int   *growth_offset;      /* OFFSET(row,col), 10/17/2026 */
 /* The following two lines were replaced by D. Donato on 06/21/2006
 ****  D. Donato  Aug. 14, 2006                                              **/
 
 /** D. Donato 8/17/2006 Added to deal with cumulative growth                 **/
-  static short *zgrwth_row;
-  static short *zgrwth_col;
+  static int   *zgrwth_offset;
   static int    zgrwth_count;
 /** D. Donato 8/17/2006 Added to deal with cumulative growth                 **/
 
+/* urban pixels that may still have a non-urban neighbor (ORGANIC_FRONTIER) */
+  static int   *frontier_offset;
+  static int    frontier_count;
+
+/* interior, non-excluded, non-urban pixels (ELIGIBLE_CELL_SAMPLING) */
+  static int   *elig_cell;
+  static int   *elig_pos;
+  static int    elig_count;
+
+/* slope weights as thresholds for ran_Exceeds; set with the weights */
+  static ran_threshold_t slope_threshold[SLOPE_WEIGHT_ARRAY_SZ];
+
+/* fused slope and exclusion acceptance (FUSED_ACCEPTANCE_GRID), scaled */
+/* to ACCEPT_SCALE; rebuilt only when the slope resistance changes      */
+  static unsigned short *accept_grid;
+  static unsigned short slope_accept[SLOPE_WEIGHT_ARRAY_SZ];
+  static double accept_slope_resist = -1.0;
+
+/* values derived from the current coefficients, rebuilt by            */
+/* spr_plan_update only when coeff_GetCurrentGeneration moves on        */
+  static struct
+  {
+    BOOLEAN built;
+    unsigned int generation;
+    COEFF_TYPE diffusion_value;
+    int road_grav_value;
+    int max_search_index;
+    int road_band;
+    SWGHT_TYPE swght[SLOPE_WEIGHT_ARRAY_SZ];
+  }
+  plan;
+
+/* attempts of the parallel trials (PARALLEL_RANDOM_GROWTH), TRIAL_SLOTS */
+/* per trial, the number each made, and the draw each phase 1 trial is   */
+  static spr_attempt_t *trial_attempt;
+  static int *trial_count;
+  static int *trial_index;
+  static int trial_capacity;
+
+/* lengths of the replica growth and phase 4 lists (BIT_SLICED_REPLICAS) */
+  static int rep_growth_count;
+  static int rep_spread_count;
+
+/* each thread of a PARALLEL_MONTE_CARLO pool grows its own iteration; */
+/* the road grids' search structures and walk table are shared, and   */
+/* rporow_ptrNum stays shared too, as spr_road_select never resets it. */
+/* A thread's copies are its own, so the parallel phases copy in what  */
+/* their loops read from the thread that starts them.                  */
+#ifdef _OPENMP
+#pragma omp threadprivate (road_growth_breed_coefficient)
+#pragma omp threadprivate (road_growth_diffusion_coefficient)
+#pragma omp threadprivate (int_road_gravity, rpoIndex)
+#pragma omp threadprivate (rporow_ptrMin, rporow_ptrMax, rporow_ptrIdx)
+#pragma omp threadprivate (rpocol_ptr, rponear_ptr, bn_search_index, bn_cached)
+#pragma omp threadprivate (rponearCol, rponearIdx, rponearList)
+#pragma omp threadprivate (rponodeOff, rponodeNbr, rponodeMask, rponodeVal)
+#pragma omp threadprivate (growth_count, growth_offset)
+#pragma omp threadprivate (zgrwth_offset, zgrwth_count)
+#pragma omp threadprivate (frontier_offset, frontier_count)
+#pragma omp threadprivate (elig_cell, elig_pos, elig_count, slope_threshold)
+#pragma omp threadprivate (accept_grid, slope_accept, accept_slope_resist)
+#pragma omp threadprivate (plan)
+#pragma omp threadprivate (trial_attempt, trial_count, trial_index)
+#pragma omp threadprivate (trial_capacity, rep_growth_count, rep_spread_count)
+#endif
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -144,6 +260,70 @@ static void
                 SWGHT_TYPE * swght,                          /* IN     */
                 int *og);                                    /* IN/OUT */
 
+static void
+    spr_phase4_stencil (COEFF_TYPE spread_coefficient,       /* IN     */
+                        GRID_P z,                            /* IN     */
+                        GRID_P excld,                        /* IN     */
+                        GRID_P delta,                        /* IN/OUT */
+                        GRID_P slp,                          /* IN     */
+                        SWGHT_TYPE * swght,                  /* IN     */
+                        int *scan_offset,                    /* IN     */
+                        int nscan,                           /* IN     */
+                        MASK_WORD * spreadmask,              /* IN     */
+                        int *og);                            /* IN/OUT */
+
+#ifdef _OPENMP
+static int spr_num_threads ();
+#endif
+static void spr_trial_reserve (int ntrials);                 /* IN     */
+static BOOLEAN
+    spr_trial_urbanize (ran_stream_t * stream,               /* IN/OUT */
+                        int row,                             /* IN     */
+                        int col,                             /* IN     */
+                        GRID_P z,                            /* IN     */
+                        GRID_P delta,                        /* IN     */
+                        GRID_P slp,                          /* IN     */
+                        GRID_P excld,                        /* IN     */
+                        PIXEL pixel_value,                   /* IN     */
+                        int *stat,                           /* IN     */
+                        spr_attempt_t * attempt,             /* IN/OUT */
+                        int *count);                         /* IN/OUT */
+static BOOLEAN
+    spr_trial_urbanize_nghbr (ran_stream_t * stream,         /* IN/OUT */
+                              int i,                         /* IN     */
+                              int j,                         /* IN     */
+                              int *i_nghbr,                  /* OUT    */
+                              int *j_nghbr,                  /* OUT    */
+                              GRID_P z,                      /* IN     */
+                              GRID_P delta,                  /* IN     */
+                              GRID_P slp,                    /* IN     */
+                              GRID_P excld,                  /* IN     */
+                              PIXEL pixel_value,             /* IN     */
+                              int *stat,                     /* IN     */
+                              spr_attempt_t * attempt,       /* IN/OUT */
+                              int *count);                   /* IN/OUT */
+static void
+    spr_trial_merge (int ntrials,                            /* IN     */
+                     GRID_P delta);                          /* IN/OUT */
+static void
+    spr_phase1n3_trials (COEFF_TYPE diffusion_coefficient,   /* IN     */
+                         COEFF_TYPE breed_coefficient,       /* IN     */
+                         GRID_P z,                           /* IN     */
+                         GRID_P delta,                       /* IN/OUT */
+                         GRID_P slp,                         /* IN     */
+                         GRID_P excld,                       /* IN     */
+                         int *sng,                           /* IN/OUT */
+                         int *sdc);                          /* IN/OUT */
+static void
+    spr_phase5_trials (COEFF_TYPE road_gravity,              /* IN     */
+                       COEFF_TYPE diffusion_coefficient,     /* IN     */
+                       COEFF_TYPE breed_coefficient,         /* IN     */
+                       GRID_P z,                             /* IN     */
+                       GRID_P delta,                         /* IN/OUT */
+                       GRID_P slp,                           /* IN     */
+                       GRID_P excld,                         /* IN     */
+                       GRID_P roads,                         /* IN     */
+                       int *rt);                             /* IN/OUT */
 
 static void
     spr_phase5 (COEFF_TYPE road_gravity,                     /* IN     */
@@ -163,19 +343,57 @@ static void
 static void
     spr_get_slp_weights (int array_size,                     /* IN     */
                          SWGHT_TYPE * lut);                  /* OUT    */
-static BOOLEAN spr_road_search (short i_grwth_center,        /* IN     */
-                                short j_grwth_center,        /* IN     */
+static void spr_plan_update ();
+static void
+    spr_build_accept_grid (GRID_P slp,                       /* IN     */
+                           GRID_P excld,                     /* IN     */
+                           SWGHT_TYPE * swght);              /* IN     */
+static BOOLEAN spr_road_search (int i_grwth_center,          /* IN     */
+                                int j_grwth_center,          /* IN     */
                                 int *i_road,                 /* OUT    */
                                 int *j_road,                 /* OUT    */
                                 int max_search_index,        /* IN     */
                                 GRID_P roads);               /* IN     */
+static int spr_road_band (int max_search_index);             /* IN     */
+static BOOLEAN spr_road_nearest (int crow,                   /* IN     */
+                                 int ccol,                   /* IN     */
+                                 int N,                      /* IN     */
+                                 int *i_road,                /* OUT    */
+                                 int *j_road);               /* OUT    */
+static void spr_road_select (GRID_P roads);                  /* IN     */
+static void
+    spr_replica_grow (int offset,                            /* IN     */
+                      MASK_WORD bit,                         /* IN     */
+                      MASK_WORD * delta);                    /* IN/OUT */
+static BOOLEAN
+    spr_replica_urbanize (ran_stream_t * stream,             /* IN/OUT */
+                          int offset,                        /* IN     */
+                          MASK_WORD bit,                     /* IN     */
+                          MASK_WORD * z,                     /* IN     */
+                          MASK_WORD * delta,                 /* IN/OUT */
+                          GRID_P slp,                        /* IN     */
+                          GRID_P excld,                      /* IN     */
+                          int *stat);                        /* IN/OUT */
+static BOOLEAN
+    spr_replica_urbanize_nghbr (ran_stream_t * stream,       /* IN/OUT */
+                                int i,                       /* IN     */
+                                int j,                       /* IN     */
+                                int *i_nghbr,                /* OUT    */
+                                int *j_nghbr,                /* OUT    */
+                                MASK_WORD bit,               /* IN     */
+                                MASK_WORD * z,               /* IN     */
+                                MASK_WORD * delta,           /* IN/OUT */
+                                GRID_P slp,                  /* IN     */
+                                GRID_P excld,                /* IN     */
+                                int *stat);                  /* IN/OUT */
 static
   BOOLEAN spr_road_walk (int i_road_start,                   /* IN     */
                          int j_road_start,                   /* IN     */
                          int *i_road_end,                    /* OUT    */
                          int *j_road_end,                    /* OUT    */
                          GRID_P roads,                       /* IN     */
-                         double diffusion_coefficient);      /* IN     */
+                         double diffusion_coefficient,       /* IN     */
+                         ran_stream_t * stream);             /* IN/OUT */
 static
   BOOLEAN spr_urbanize_nghbr (int i,                         /* IN     */
                               int j,                         /* IN     */
@@ -205,6 +423,12 @@ static BOOLEAN
                   PIXEL pixel_value,                         /* IN     */
                   int *stat);                                /* OUT    */
 
+static void
+    spr_eligible_remove (int offset);                        /* IN     */
+static int
+    spr_eligible_skip (int max_skip,                         /* IN     */
+                       double log_miss);                     /* IN     */
+
 static COEFF_TYPE
     spr_GetDiffusionValue (COEFF_TYPE diffusion_coeff);      /* IN    */
 static COEFF_TYPE
@@ -213,6 +437,10 @@ static COEFF_TYPE
 /***                          D.D. July 28, 2006               (Begin)      **/
   static void spr_rpoList_Init(void);
   static void spr_rpoPopulate(int);
+  static void spr_rpoNearest(int);
+  static BOOLEAN spr_rpoNearSame(int, int, int *);
+  static void spr_rpoGraph(int);
+  static int  spr_rpoNode(int, int, int);
   int max( int, int );
 /*******************          D.D. July 28, 2006      (End)  ******************/
 
@@ -256,6 +484,10 @@ static void
   int count;
   int tries;
   int max_tries;
+  int ndraws;
+  int skip;
+  int ncols;
+  double log_miss;
   COEFF_TYPE diffusion_value;
   BOOLEAN urbanized;
 
@@ -272,11 +504,39 @@ static void
   assert (sng != NULL);
   assert (sdc != NULL);
 
-  diffusion_value = spr_GetDiffusionValue (diffusion_coefficient);
-  for (k = 0; k < 1 + (int) diffusion_value; k++)
+  diffusion_value = plan.diffusion_value;
+  ndraws = 1 + (int) diffusion_value;
+  ncols = igrid_GetNumCols ();
+  log_miss = 0.0;
+  if ((elig_cell != NULL) && (elig_count < mem_GetTotalPixels ()))
+  {
+    log_miss = log (1.0 - (double) elig_count / mem_GetTotalPixels ());
+  }
+  for (k = 0; k < ndraws; k++)
   {
-    i = RANDOM_ROW;
-    j = RANDOM_COL;
+    if (elig_cell != NULL)
+    {
+      /*
+       *
+       * JUMP OVER THE DRAWS THAT WOULD MISS EVERY ELIGIBLE CELL
+       *
+       */
+      skip = spr_eligible_skip (ndraws - k, log_miss);
+      stats_AddSkippedDraws (skip);
+      k += skip;
+      if (k >= ndraws)
+      {
+        break;
+      }
+      i = elig_cell[ran_Bounded (ran_stream, elig_count)];
+      j = i % ncols;
+      i = i / ncols;
+    }
+    else
+    {
+      i = RANDOM_ROW;
+      j = RANDOM_COL;
+    }
 
     if (INTERIOR_PT (i, j))
     {
@@ -326,6 +586,123 @@ static void
   FUNC_END;
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_InitEligibleCells
+** PURPOSE:       build the eligible cell index
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Lists every interior, non-excluded pixel that is not
+**                urban in z. The index stays valid as long as z only
+**                gains urban pixels through spr_spread, so grw_grow
+**                rebuilds it after seeding each Monte Carlo run.
+**
+**
+*/
+void
+  spr_InitEligibleCells (GRID_P z)                           /* IN     */
+{
+  char func[] = "spr_InitEligibleCells";
+  int row;
+  int col;
+  int nrows;
+  int ncols;
+  GRID_P excld;
+
+  FUNC_INIT;
+  elig_cell = mem_GetEligiblePtr ();
+  elig_pos = mem_GetEligiblePosPtr ();
+  if (elig_cell != NULL)
+  {
+    nrows = igrid_GetNumRows ();
+    ncols = igrid_GetNumCols ();
+    excld = igrid_GetExcludedGridPtr (__FILE__, func, __LINE__);
+    elig_count = 0;
+    for (row = 0; row < nrows; row++)
+    {
+      for (col = 0; col < ncols; col++)
+      {
+        elig_pos[OFFSET (row, col)] = -1;
+        if (INTERIOR_PT (row, col) &&
+            (z[OFFSET (row, col)] == 0) &&
+            (excld[OFFSET (row, col)] < 100))
+        {
+          elig_pos[OFFSET (row, col)] = elig_count;
+          elig_cell[elig_count++] = OFFSET (row, col);
+        }
+      }
+    }
+    excld = igrid_GridRelease (__FILE__, func, __LINE__, excld);
+    mem_SetEligibleCount (elig_count);
+  }
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_eligible_remove
+** PURPOSE:       drop a newly urban pixel from the eligible cells
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Moves the last entry into the hole, so the index stays
+**                dense and removal costs O(1).
+**
+**
+*/
+static void
+  spr_eligible_remove (int offset)                           /* IN     */
+{
+  int k;
+
+  k = elig_pos[offset];
+  if (k >= 0)
+  {
+    elig_count--;
+    elig_cell[k] = elig_cell[elig_count];
+    elig_pos[elig_cell[k]] = k;
+    elig_pos[offset] = -1;
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_eligible_skip
+** PURPOSE:       count the draws before the next eligible cell
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   A uniform draw over the whole grid lands on an eligible
+**                cell with probability p = elig_count / total pixels, so
+**                the number of misses before the next hit is geometric:
+**                floor (log (U) / log (1 - p)). Returns max_skip when the
+**                next hit would come after the last draw.
+**
+**
+*/
+static int
+  spr_eligible_skip (int max_skip,                           /* IN     */
+                     double log_miss)                        /* IN     */
+{
+  double skip;
+
+  if (elig_count == 0)
+  {
+    return max_skip;
+  }
+  if (log_miss == 0.0)
+  {
+    return 0;
+  }
+  skip = floor (log (1.0 - RANDOM_FLOAT) / log_miss);
+  if (skip >= (double) max_skip)
+  {
+    return max_skip;
+  }
+  return (int) skip;
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: spr_phase4
@@ -360,8 +737,29 @@ static void
   int urb_count;
   int nrows;
   int ncols;
+  int frontier;
+  int nscan;
+  int *scan_offset;
+  int wpr;
+  BOOLEAN spreads;
+  GRID_P nbrcount;
+  MASK_WORD *spreadmask;
 
   FUNC_INIT;
+  nbrcount = mem_GetNbrCountPtr ();
+  frontier = scen_GetOrganicFrontier ();
+  spreadmask = NULL;
+  if ((nbrcount == NULL) && (mem_GetZMaskPtr () != NULL))
+  {
+    /*
+     *
+     * Z IS FIXED DURING THE PHASE, SO THE NEIGHBOR TEST CAN BE DONE
+     * FOR THE WHOLE GRID UP FRONT, 64 PIXELS AT A TIME
+     *
+     */
+    spreadmask = mem_GetSpreadMaskPtr ();
+    util_mask_spreading (mem_GetZMaskPtr (), spreadmask);
+  }
   assert (z != NULL);
   assert (excld != NULL);
   assert (delta != NULL);
@@ -373,6 +771,33 @@ static void
   ncols = igrid_GetNumCols ();
   assert (nrows > 0);
   assert (ncols > 0);
+  wpr = MASK_WORDS_PER_ROW (ncols);
+
+  scan_offset = zgrwth_offset;
+  nscan = zgrwth_count;
+  if (frontier == ORGANIC_FRONTIER_ON)
+  {
+    /*
+     *
+     * DROP BORDER PIXELS AND PIXELS WITH EIGHT URBAN NEIGHBORS FROM
+     * THE FRONTIER. COUNTS ONLY GROW, SO THEY NEVER COME BACK; THE
+     * SURVIVORS KEEP THEIR ORDER.
+     *
+     */
+    nscan = 0;
+    for (i = 0; i < frontier_count; i++)
+    {
+      row = frontier_offset[i] / ncols;
+      col = frontier_offset[i] % ncols;
+      if (row < 1 || row >= nrows - 1) continue;
+      if (col < 1 || col >= ncols - 1) continue;
+      if (nbrcount[frontier_offset[i]] == 8) continue;
+      frontier_offset[nscan] = frontier_offset[i];
+      nscan++;
+    }
+    frontier_count = nscan;
+    scan_offset = frontier_offset;
+  }
 
   /*
    *
@@ -387,52 +812,93 @@ static void
     for (col = 1; col < ncols - 1; col++)
     {
 ***                                                                         */
-  for (i=0; i< zgrwth_count; i++)
-    {
-      row = zgrwth_row[i];
-      col = zgrwth_col[i];
-      /*
-       *
-       * D.D. 8/18/2006 -- IS THIS AN INTERIOR PIXEL?
-       *
-       */
-      if (row < 1 || row >= nrows - 1) continue;
-      if (col < 1 || col >= ncols - 1) continue;
-      /*
-       *
-       * IS THIS AN URBAN PIXEL AND DO WE PASS THE RANDOM 
-       * SPREAD COEFFICIENT TEST
-       *
-       */
-      if ((z[OFFSET (row, col)] > 0) &&
-          (RANDOM_INT (101) < spread_coefficient))
-      {
-        /*
-         * EXAMINE THE EIGHT CELL NEIGHBORS
-         * SPREAD AT RANDOM IF AT LEAST TWO ARE URBAN
-         * PIXEL ITSELF MUST BE URBAN (3)
-         *
-         */
-        urb_count = util_count_neighbors (z, row, col, GT, 0);
-        if ((urb_count >= 2) && (urb_count < 8))
-        {
-          pixel = RANDOM_INT (8);
-
-          row_nghbr = row + walkabout_row[pixel];
-          col_nghbr = col + walkabout_col[pixel];
-
-          spr_urbanize (row_nghbr,                           /* IN     */
-                        col_nghbr,                           /* IN     */
+  if (scen_GetParallelOrganicGrowthFlag ())
+  {
+    spr_phase4_stencil (spread_coefficient,                  /* IN     */
                         z,                                   /* IN     */
+                        excld,                               /* IN     */
                         delta,                               /* IN/OUT */
                         slp,                                 /* IN     */
-                        excld,                               /* IN     */
                         swght,                               /* IN     */
-                        PHASE4G,                             /* IN     */
+                        scan_offset,                         /* IN     */
+                        nscan,                               /* IN     */
+                        spreadmask,                          /* IN     */
                         og);                                 /* IN/OUT */
+  }
+  else
+  {
+    for (i=0; i< nscan; i++)
+      {
+        row = scan_offset[i] / ncols;
+        col = scan_offset[i] % ncols;
+        /*
+         *
+         * D.D. 8/18/2006 -- IS THIS AN INTERIOR PIXEL?
+         *
+         */
+        if (row < 1 || row >= nrows - 1) continue;
+        if (col < 1 || col >= ncols - 1) continue;
+        /*
+         *
+         * A PIXEL WITH EIGHT URBAN NEIGHBORS CANNOT SPREAD; ONLY
+         * CONSUME THE RANDOM DRAW IT WOULD HAVE TAKEN
+         *
+         */
+        if ((frontier == ORGANIC_FRONTIER_LEGACY) &&
+            (nbrcount[OFFSET (row, col)] == 8))
+        {
+          RANDOM_INT (101);
+          continue;
+        }
+        /*
+         *
+         * IS THIS AN URBAN PIXEL AND DO WE PASS THE RANDOM 
+         * SPREAD COEFFICIENT TEST
+         *
+         */
+        if ((z[OFFSET (row, col)] > 0) &&
+            (RANDOM_INT (101) < spread_coefficient))
+        {
+          /*
+           * EXAMINE THE EIGHT CELL NEIGHBORS
+           * SPREAD AT RANDOM IF AT LEAST TWO ARE URBAN
+           * PIXEL ITSELF MUST BE URBAN (3)
+           *
+           */
+          if (nbrcount != NULL)
+          {
+            urb_count = nbrcount[OFFSET (row, col)];
+            spreads = (urb_count >= 2) && (urb_count < 8);
+          }
+          else if (spreadmask != NULL)
+          {
+            spreads = MASK_TEST (spreadmask, wpr, row, col);
+          }
+          else
+          {
+            urb_count = util_count_neighbors (z, row, col, GT, 0);
+            spreads = (urb_count >= 2) && (urb_count < 8);
+          }
+          if (spreads)
+          {
+            pixel = RANDOM_INT (8);
+
+            row_nghbr = row + walkabout_row[pixel];
+            col_nghbr = col + walkabout_col[pixel];
+
+            spr_urbanize (row_nghbr,                           /* IN     */
+                          col_nghbr,                           /* IN     */
+                          z,                                   /* IN     */
+                          delta,                               /* IN/OUT */
+                          slp,                                 /* IN     */
+                          excld,                               /* IN     */
+                          swght,                               /* IN     */
+                          PHASE4G,                             /* IN     */
+                          og);                                 /* IN/OUT */
+          }
         }
       }
-    }
+  }
 /* D.D. 08/18/2006 **
   }
 ** D.D. 08/18/2006 */
@@ -441,113 +907,334 @@ static void
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: spr_phase5
-** PURPOSE:       perform phase 5 growth
-** AUTHOR:        Keith Clarke
-** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
-** CREATION DATE: 11/11/1999
+** FUNCTION NAME: spr_phase4_stencil
+** PURPOSE:       perform phase 4 growth on every thread
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
 ** DESCRIPTION:
-**
+**                PARALLEL_ORGANIC_GROWTH. Every pixel of the scan list
+**                draws one ran_KeyedBlock keyed by its offset and the
+**                year: a word for the spread test, one for the
+**                neighbor, and one or two for the slope and exclusion
+**                tests. The attempts only read z and delta, so the
+**                threads split the list between them and record the
+**                pixel each attempt claims. A serial pass then gives
+**                each claimed pixel to the claimant with the lowest
+**                offset, counts the others as delta failures as the
+**                serial loop would, and places the growth in list
+**                order. Nothing depends on how the list was split,
+**                so the result does not depend on the thread count.
 **
 */
 static void
-  spr_phase5 (COEFF_TYPE road_gravity,                       /* IN     */
-              COEFF_TYPE diffusion_coefficient,              /* IN     */
-              COEFF_TYPE breed_coefficient,                  /* IN     */
-              GRID_P z,                                      /* IN     */
-              GRID_P delta,                                  /* IN/OUT */
-              GRID_P slp,                                    /* IN     */
-              GRID_P excld,                                  /* IN     */
-              GRID_P roads,                                  /* IN     */
-              SWGHT_TYPE * swght,                            /* IN     */
-              int *rt)                                       /* IN/OUT */
-  /* D.D. Changed July 24, 2006 - No longer passing workspace
-              int *rt,                                       ** IN/OUT **
-              GRID_P workspace)                              ** MOD    **
-  */
-
+  spr_phase4_stencil (COEFF_TYPE spread_coefficient,         /* IN     */
+                      GRID_P z,                              /* IN     */
+                      GRID_P excld,                          /* IN     */
+                      GRID_P delta,                          /* IN/OUT */
+                      GRID_P slp,                            /* IN     */
+                      SWGHT_TYPE * swght,                    /* IN     */
+                      int *scan_offset,                      /* IN     */
+                      int nscan,                             /* IN     */
+                      MASK_WORD * spreadmask,                /* IN     */
+                      int *og)                               /* IN/OUT */
 {
-  char func[] = "spr_phase5";
-  int iii;
-/** D. Donato Aug. 14, 2006 Following line moved to module level        **
-  int growth_count;
-***     D. Donato  Aug. 14, 2006                                        */
-
-/* D.D. The following two lines were restored July 24, 2006 */
-/* On 8/10/2006 "int *" was changed to "short *".           */
-/* On 8/14/2006 these two lines were moved to module level. **
-  short *growth_row;
-  short *growth_col;
-** D. Donato 8/14/2006                                      */
-
-/* The following two lines were replaced by D. Donato on 06/21/2006
-  int *growth_row;
-  int *growth_col;
-*/
-/* D.D. The following two lines were rescinded July 24, 2006.
-  GRID_P growth_row;
-  GRID_P growth_col;
-*/
-  int max_search_index;
-  int growth_index;
-  BOOLEAN road_found;
-  int i_rd_start;
-  int j_rd_start;
-  int max_tries;
-  BOOLEAN spread;
-  BOOLEAN urbanized;
-  int i_rd_end;
-  int j_rd_end;
-  int i_rd_end_nghbr;
-  int j_rd_end_nghbr;
-  int i_rd_end_nghbr_nghbr;
-  int j_rd_end_nghbr_nghbr;
-  int tries;
+  char func[] = "spr_phase4_stencil";
+  int walkabout_row[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+  int walkabout_col[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+  int i;
   int nrows;
   int ncols;
-  int total_pixels;
-float temp4;
-int growth_count_fixed;
+  int wpr;
+  int year;
+  int monte_carlo;
+  int target;
+  int *claim;
+  int *cand;
+  GRID_P nbrcount;
 
   FUNC_INIT;
-  assert (road_gravity >= 0.0);
-  assert (diffusion_coefficient >= 0.0);
-  assert (breed_coefficient >= 0.0);
   assert (z != NULL);
+  assert (excld != NULL);
   assert (delta != NULL);
   assert (slp != NULL);
-  assert (excld != NULL);
-  assert (roads != NULL);
   assert (swght != NULL);
-  assert (rt != NULL);
-/** D.D. Following line disabled.   **
-  assert (workspace != NULL);
-***                                **/
+  assert (og != NULL);
+
   nrows = igrid_GetNumRows ();
   ncols = igrid_GetNumCols ();
-  assert (nrows > 0);
-  assert (ncols > 0);
-
-  total_pixels = mem_GetTotalPixels ();
-  assert (total_pixels > 0);
+  wpr = MASK_WORDS_PER_ROW (ncols);
+  year = proc_GetCurrentYear ();
+  monte_carlo = ran_GetMonteCarlo ();
+  claim = mem_GetClaimPtr ();
+  cand = mem_GetCandidatePtr ();
+  nbrcount = mem_GetNbrCountPtr ();
+  assert (claim != NULL);
+  assert (cand != NULL);
 
   /*
    *
-   * SET UP WORKSPACE
+   * EVERY ATTEMPT, IN PARALLEL; NOTHING IS WRITTEN BUT cand
    *
    */
-  
-/* The following two lines were replaced by D. Donato 6/21/2006
-  growth_row = (int *) workspace;
-  growth_col = (int *) workspace + (nrows);
-*/
-/* D.D. The following two lines were replaced July 24, 2006
-  growth_row = (GRID_P) workspace;
-  growth_col = (GRID_P) workspace + (nrows);
-  On 8/10/2006 "int *" was changed to "short *".
-*/
-/* the following two lines were moved to spr_spread 8/14/2006  **
-  growth_row = (short *)  mem_GetGRCrowptr();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(spr_num_threads ()) \
+  copyin (accept_grid, slope_accept, slope_threshold)
+#endif
+  for (i = 0; i < nscan; i++)
+  {
+    unsigned int words[4];
+    int row;
+    int col;
+    int offset;
+    int pixel;
+    int draw;
+    int urb_count;
+    int k;
+    int t;
+    BOOLEAN spreads;
+
+    offset = scan_offset[i];
+    row = offset / ncols;
+    col = offset % ncols;
+    cand[i] = P4_NO_ATTEMPT;
+    if (row < 1 || row >= nrows - 1) continue;
+    if (col < 1 || col >= ncols - 1) continue;
+    if (z[offset] == 0) continue;
+
+    ran_ReplicaBlock (RAN_SUBSTREAM_PHASE4, year, offset, monte_carlo, words);
+    if (RAN_WORD_BOUNDED (words[0], 101) >= spread_coefficient) continue;
+
+    if (nbrcount != NULL)
+    {
+      urb_count = nbrcount[offset];
+      spreads = (urb_count >= 2) && (urb_count < 8);
+    }
+    else if (spreadmask != NULL)
+    {
+      spreads = MASK_TEST (spreadmask, wpr, row, col);
+    }
+    else
+    {
+      /* util_count_neighbors pushes the call stack, so count here */
+      urb_count = 0;
+      for (k = 0; k < 8; k++)
+      {
+        if (z[OFFSET (row + walkabout_row[k], col + walkabout_col[k])] > 0)
+        {
+          urb_count++;
+        }
+      }
+      spreads = (urb_count >= 2) && (urb_count < 8);
+    }
+    if (!spreads) continue;
+
+    pixel = RAN_WORD_BOUNDED (words[1], 8);
+    t = OFFSET (row + walkabout_row[pixel], col + walkabout_col[pixel]);
+    if (z[t] != 0)
+    {
+      cand[i] = P4_Z_FAILURE;
+    }
+    else if (delta[t] != 0)
+    {
+      cand[i] = P4_DELTA_FAILURE;
+    }
+    else if (accept_grid != NULL)
+    {
+      draw = RAN_WORD_BOUNDED (words[2], ACCEPT_SCALE);
+      if (draw < accept_grid[t])
+      {
+        cand[i] = t;
+      }
+      else if (draw < slope_accept[slp[t]])
+      {
+        cand[i] = P4_EXCLUDED_FAILURE;
+      }
+      else
+      {
+        cand[i] = P4_SLOPE_FAILURE;
+      }
+    }
+    else if ((unsigned long long) words[2] >= slope_threshold[slp[t]].words)
+    {
+      if (excld[t] < RAN_WORD_BOUNDED (words[3], 100))
+      {
+        cand[i] = t;
+      }
+      else
+      {
+        cand[i] = P4_EXCLUDED_FAILURE;
+      }
+    }
+    else
+    {
+      cand[i] = P4_SLOPE_FAILURE;
+    }
+  }
+
+  /*
+   *
+   * THE LOWEST OFFSET WINS EACH CLAIMED PIXEL
+   *
+   */
+  for (i = 0; i < nscan; i++)
+  {
+    target = cand[i];
+    if (target < 0) continue;
+    if ((claim[target] < 0) ||
+        (scan_offset[i] < scan_offset[claim[target]]))
+    {
+      claim[target] = i;
+    }
+  }
+
+  /*
+   *
+   * PLACE THE GROWTH AND COUNT THE OUTCOMES IN LIST ORDER; EACH
+   * WINNER HANDS ITS claim ENTRY BACK
+   *
+   */
+  for (i = 0; i < nscan; i++)
+  {
+    target = cand[i];
+    switch (target)
+    {
+    case P4_NO_ATTEMPT:
+      break;
+    case P4_Z_FAILURE:
+      stats_IncrementZFailure ();
+      break;
+    case P4_DELTA_FAILURE:
+      stats_IncrementDeltaFailure ();
+      break;
+    case P4_SLOPE_FAILURE:
+      stats_IncrementSlopeFailure ();
+      break;
+    case P4_EXCLUDED_FAILURE:
+      stats_IncrementEcludedFailure ();
+      break;
+    default:
+      if (claim[target] != i)
+      {
+        stats_IncrementDeltaFailure ();
+        break;
+      }
+      claim[target] = -1;
+      delta[target] = PHASE4G;
+      growth_offset[growth_count] = target;
+      growth_count++;
+      (*og)++;
+      stats_IncrementUrbanSuccess ();
+      break;
+    }
+  }
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_phase5
+** PURPOSE:       perform phase 5 growth
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**
+**
+*/
+static void
+  spr_phase5 (COEFF_TYPE road_gravity,                       /* IN     */
+              COEFF_TYPE diffusion_coefficient,              /* IN     */
+              COEFF_TYPE breed_coefficient,                  /* IN     */
+              GRID_P z,                                      /* IN     */
+              GRID_P delta,                                  /* IN/OUT */
+              GRID_P slp,                                    /* IN     */
+              GRID_P excld,                                  /* IN     */
+              GRID_P roads,                                  /* IN     */
+              SWGHT_TYPE * swght,                            /* IN     */
+              int *rt)                                       /* IN/OUT */
+  /* D.D. Changed July 24, 2006 - No longer passing workspace
+              int *rt,                                       ** IN/OUT **
+              GRID_P workspace)                              ** MOD    **
+  */
+
+{
+  char func[] = "spr_phase5";
+  int iii;
+/** D. Donato Aug. 14, 2006 Following line moved to module level        **
+  int growth_count;
+***     D. Donato  Aug. 14, 2006                                        */
+
+/* D.D. The following two lines were restored July 24, 2006 */
+/* On 8/10/2006 "int *" was changed to "short *".           */
+/* On 8/14/2006 these two lines were moved to module level. **
+  short *growth_row;
+  short *growth_col;
+** D. Donato 8/14/2006                                      */
+
+/* The following two lines were replaced by D. Donato on 06/21/2006
+  int *growth_row;
+  int *growth_col;
+*/
+/* D.D. The following two lines were rescinded July 24, 2006.
+  GRID_P growth_row;
+  GRID_P growth_col;
+*/
+  int max_search_index;
+  int growth_index;
+  BOOLEAN road_found;
+  int i_rd_start;
+  int j_rd_start;
+  int max_tries;
+  BOOLEAN spread;
+  BOOLEAN urbanized;
+  int i_rd_end;
+  int j_rd_end;
+  int i_rd_end_nghbr;
+  int j_rd_end_nghbr;
+  int i_rd_end_nghbr_nghbr;
+  int j_rd_end_nghbr_nghbr;
+  int tries;
+  int ncols;
+float temp4;
+int growth_count_fixed;
+
+  FUNC_INIT;
+  assert (road_gravity >= 0.0);
+  assert (diffusion_coefficient >= 0.0);
+  assert (breed_coefficient >= 0.0);
+  assert (z != NULL);
+  assert (delta != NULL);
+  assert (slp != NULL);
+  assert (excld != NULL);
+  assert (roads != NULL);
+  assert (swght != NULL);
+  assert (rt != NULL);
+/** D.D. Following line disabled.   **
+  assert (workspace != NULL);
+***                                **/
+  ncols = igrid_GetNumCols ();
+  assert (igrid_GetNumRows () > 0);
+  assert (ncols > 0);
+  assert (mem_GetTotalPixels () > 0);
+
+  /*
+   *
+   * SET UP WORKSPACE
+   *
+   */
+  
+/* The following two lines were replaced by D. Donato 6/21/2006
+  growth_row = (int *) workspace;
+  growth_col = (int *) workspace + (nrows);
+*/
+/* D.D. The following two lines were replaced July 24, 2006
+  growth_row = (GRID_P) workspace;
+  growth_col = (GRID_P) workspace + (nrows);
+  On 8/10/2006 "int *" was changed to "short *".
+*/
+/* the following two lines were moved to spr_spread 8/14/2006  **
+  growth_row = (short *)  mem_GetGRCrowptr();
   growth_col = (short *)  mem_GetGRCcolptr();
 ** D. Donato 8/14/2006                                         */
 
@@ -629,11 +1316,11 @@ growth_count_fixed=growth_count;
        * indexed values would be
        * 8 + 16 + 24 + ... + 8*N = 8*(1+2+3+...+N) = 8*(N(1+N))/2
        *
+       * (worked out once per coefficient change by spr_plan_update)
+       *
        */
-      int_road_gravity = spr_GetRoadGravValue (road_gravity);
-      max_search_index = 4 * (int_road_gravity * (1 + int_road_gravity));
-      max_search_index = MAX (max_search_index, nrows);
-      max_search_index = MAX (max_search_index, ncols);
+      int_road_gravity = plan.road_grav_value;
+      max_search_index = plan.max_search_index;
 
       /*
        *
@@ -641,8 +1328,15 @@ growth_count_fixed=growth_count;
        * FOR ROAD
        *
        */
-temp4=RANDOM_FLOAT;
-      growth_index = (int) ((double) growth_count_fixed * temp4);
+      if (ran_GetEngine () == RANDOM_ENGINE_LEGACY)
+      {
+        temp4 = RANDOM_FLOAT;
+        growth_index = (int) ((double) growth_count_fixed * temp4);
+      }
+      else
+      {
+        growth_index = RANDOM_INT (growth_count_fixed);
+      }
 
       /*
        *
@@ -652,8 +1346,8 @@ temp4=RANDOM_FLOAT;
 
 
       road_found =
-        spr_road_search (growth_row[growth_index],
-                         growth_col[growth_index],
+        spr_road_search (growth_offset[growth_index] / ncols,
+                         growth_offset[growth_index] % ncols,
                          &i_rd_start,
                          &j_rd_start,
                          max_search_index,
@@ -686,7 +1380,8 @@ temp4=RANDOM_FLOAT;
                                 &i_rd_end,                   /* OUT    */
                                 &j_rd_end,                   /* OUT    */
                                 roads,                       /* IN     */
-                                road_growth_diffusion_coefficient);    /* IN     */
+                                road_growth_diffusion_coefficient,    /* IN     */
+                                ran_stream);                 /* IN/OUT */
 
         if (spread == TRUE)
         {
@@ -731,313 +1426,553 @@ temp4=RANDOM_FLOAT;
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: spr_get_slp_weights
-** PURPOSE:       calculate the slope weights
-** AUTHOR:        Keith Clarke
-** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
-** CREATION DATE: 11/11/1999
-** DESCRIPTION:
-**
+** FUNCTION NAME: spr_num_threads
+** PURPOSE:       return the number of threads for a parallel phase
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   NUM_THREADS, or the OpenMP default when it is 0. One
+**                within a PARALLEL_MONTE_CARLO thread, which has the
+**                others busy already. Only built with OpenMP.
 **
 */
-static void
-  spr_get_slp_weights (int array_size,                       /* IN     */
-                       SWGHT_TYPE * lut)                     /* OUT    */
+#ifdef _OPENMP
+static int
+  spr_num_threads ()
 {
-  char func[] = "spr_get_slp_weights";
-  float val;
-  float exp;
-  int i;
-
-  FUNC_INIT;
-  assert (lut != NULL);
-
-  exp = coeff_GetCurrentSlopeResist () / (MAX_SLOPE_RESISTANCE_VALUE / 2.0);
-  for (i = 0; i < array_size; i++)
+  if (omp_in_parallel ())
   {
-    if (i < scen_GetCriticalSlope ())
-    {
-      val = (scen_GetCriticalSlope () - (SWGHT_TYPE) i) / scen_GetCriticalSlope ();
-      lut[i] = 1.0 - pow (val, exp);
-    }
-    else
-    {
-      lut[i] = 1.0;
-    }
+    return 1;
   }
-  if (scen_GetLogFlag ())
+  if (scen_GetNumThreads () > 0)
   {
-    if (scen_GetLogSlopeWeightsFlag ())
-    {
-      scen_Append2Log ();
-      spr_LogSlopeWeights (scen_GetLogFP (), array_size, lut);
-      scen_CloseLog ();
-    }
+    return scen_GetNumThreads ();
   }
-  FUNC_END;
+  return omp_get_max_threads ();
 }
+#endif
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: spr_LogSlopeWeights
-** PURPOSE:       log slope weights to FILE * fp
-** AUTHOR:        Keith Clarke
-** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
-** CREATION DATE: 11/11/1999
-** DESCRIPTION:
+** FUNCTION NAME: spr_trial_reserve
+** PURPOSE:       make room for the attempts of ntrials parallel trials
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   The number of trials follows the diffusion and breed
+**                values, so the buffers grow to the largest year seen.
 **
 **
 */
 static void
-  spr_LogSlopeWeights (FILE * fp, int array_size, SWGHT_TYPE * lut)
+  spr_trial_reserve (int ntrials)                            /* IN     */
 {
-  int i;
-
-  assert (fp != NULL);
-  assert (array_size > 0);
-  assert (lut != NULL);
+  char func[] = "spr_trial_reserve";
 
-  fprintf (fp, "\n%s %5u ***** LOG OF SLOPE WEIGHTS *****\n",
-           __FILE__, __LINE__);
-  fprintf (fp, "%s %5u CRITICAL_SLOPE= %f\n",
-           __FILE__, __LINE__, scen_GetCriticalSlope ());
-  fprintf (fp, "%s %5u coeff_GetCurrentSlopeResist= %f\n",
-           __FILE__, __LINE__, coeff_GetCurrentSlopeResist ());
-  fprintf (fp, "%s %5u MAX_SLOPE_RESISTANCE_VALUE= %f\n",
-           __FILE__, __LINE__, MAX_SLOPE_RESISTANCE_VALUE);
-  for (i = 0; i < array_size; i++)
+  FUNC_INIT;
+  if (ntrials > trial_capacity)
   {
-    if (i < scen_GetCriticalSlope ())
+    trial_attempt = realloc (trial_attempt,
+                             ntrials * TRIAL_SLOTS * sizeof (spr_attempt_t));
+    trial_count = realloc (trial_count, ntrials * sizeof (int));
+    trial_index = realloc (trial_index, ntrials * sizeof (int));
+    if ((trial_attempt == NULL) || (trial_count == NULL) || (trial_index == NULL))
     {
-      fprintf (fp, "%s %5u lut[%3u]= %f\n",
-               __FILE__, __LINE__, i, lut[i]);
+      sprintf (msg_buf, "Unable to allocate %lu bytes of memory (parallel trials)",
+               (unsigned long) (ntrials * (TRIAL_SLOTS * sizeof (spr_attempt_t) +
+                                           2 * sizeof (int))));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
     }
+    trial_capacity = ntrials;
   }
-  fprintf (fp, "All values other values to lut[%u] = 1.000000\n", array_size);
-
+  FUNC_END;
 }
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: spr_GetDiffusionValue
-** PURPOSE:       calculate the diffusion value
-** AUTHOR:        Keith Clarke
-** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
-** CREATION DATE: 11/11/1999
+** FUNCTION NAME: spr_trial_urbanize
+** PURPOSE:       record an attempt to urbanize a pixel
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
 ** DESCRIPTION:
-**
+**                spr_urbanize for a parallel trial: the same tests and
+**                draws, from the trial's stream, but the outcome is
+**                appended to the trial's attempts instead of being
+**                applied. delta is only read; a pixel this trial has
+**                already taken counts as a delta failure, as it would
+**                have in spr_urbanize. Does not push the call stack.
 **
 */
-static COEFF_TYPE
-  spr_GetDiffusionValue (COEFF_TYPE diffusion_coeff)
+static BOOLEAN
+  spr_trial_urbanize (ran_stream_t * stream,                 /* IN/OUT */
+                      int row,                               /* IN     */
+                      int col,                               /* IN     */
+                      GRID_P z,                              /* IN     */
+                      GRID_P delta,                          /* IN     */
+                      GRID_P slp,                            /* IN     */
+                      GRID_P excld,                          /* IN     */
+                      PIXEL pixel_value,                     /* IN     */
+                      int *stat,                             /* IN     */
+                      spr_attempt_t * attempt,               /* IN/OUT */
+                      int *count)                            /* IN/OUT */
 {
+  spr_attempt_t *this_attempt;
+  int offset;
+  int draw;
+  int k;
 
-  COEFF_TYPE diffusion_value;
-  double rows_sq;
-  double cols_sq;
-
-  rows_sq = igrid_GetNumRows () * igrid_GetNumRows ();
-  cols_sq = igrid_GetNumCols () * igrid_GetNumCols ();
-
-    /*VerD*/
-  /*
-   * diffusion_value's MAXIMUM (IF diffusion_coeff == 100)
-   * WILL BE 5% OF THE IMAGE DIAGONAL.
-   *  (unless overridden by AUX_DIFFUSION_MULT in scenario file)
-   */
-
-	if (aux_diffusion_mult <= 0)
-	{
-		diffusion_value = ((diffusion_coeff * 0.005) * sqrt (rows_sq + cols_sq));
-	}
-	else
-	{
-		diffusion_value = ((diffusion_coeff * aux_diffusion_mult) * sqrt (rows_sq + cols_sq));
-	}
-
-    /*VerD*/
-
-  return diffusion_value;
+  offset = OFFSET (row, col);
+  this_attempt = &attempt[*count];
+  this_attempt->offset = offset;
+  this_attempt->value = pixel_value;
+  this_attempt->stat = stat;
+  this_attempt->outcome = TRIAL_SUCCESS;
+  if (z[offset] != 0)
+  {
+    this_attempt->outcome = TRIAL_Z_FAILURE;
+  }
+  else if (delta[offset] != 0)
+  {
+    this_attempt->outcome = TRIAL_DELTA_FAILURE;
+  }
+  else
+  {
+    for (k = 0; k < *count; k++)
+    {
+      if ((attempt[k].offset == offset) &&
+          (attempt[k].outcome == TRIAL_SUCCESS))
+      {
+        this_attempt->outcome = TRIAL_DELTA_FAILURE;
+      }
+    }
+  }
+  if (this_attempt->outcome == TRIAL_SUCCESS)
+  {
+    if (accept_grid != NULL)
+    {
+      draw = ran_Bounded (stream, ACCEPT_SCALE);
+      if (draw >= accept_grid[offset])
+      {
+        this_attempt->outcome = (draw < slope_accept[slp[offset]]) ?
+          TRIAL_EXCLUDED_FAILURE : TRIAL_SLOPE_FAILURE;
+      }
+    }
+    else if (ran_Exceeds (stream, &slope_threshold[slp[offset]]))
+    {
+      if (excld[offset] >= ran_Bounded (stream, 100))
+      {
+        this_attempt->outcome = TRIAL_EXCLUDED_FAILURE;
+      }
+    }
+    else
+    {
+      this_attempt->outcome = TRIAL_SLOPE_FAILURE;
+    }
+  }
+  (*count)++;
+  return this_attempt->outcome == TRIAL_SUCCESS;
 }
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: spr_GetRoadGravValue
-** PURPOSE:       calculate the road gravity value
-** AUTHOR:        Keith Clarke
-** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
-** CREATION DATE: 11/11/1999
+** FUNCTION NAME: spr_trial_urbanize_nghbr
+** PURPOSE:       record an attempt to urbanize a neighbor
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
 ** DESCRIPTION:
-**
+**                spr_urbanize_nghbr for a parallel trial. Picks the
+**                neighbor as spr_get_neighbor does, going round from a
+**                random direction to the first one on the image, but
+**                without the state util_get_next_neighbor keeps.
 **
 */
-static COEFF_TYPE
-  spr_GetRoadGravValue (COEFF_TYPE rg_coeff)
+static BOOLEAN
+  spr_trial_urbanize_nghbr (ran_stream_t * stream,           /* IN/OUT */
+                            int i,                           /* IN     */
+                            int j,                           /* IN     */
+                            int *i_nghbr,                    /* OUT    */
+                            int *j_nghbr,                    /* OUT    */
+                            GRID_P z,                        /* IN     */
+                            GRID_P delta,                    /* IN     */
+                            GRID_P slp,                      /* IN     */
+                            GRID_P excld,                    /* IN     */
+                            PIXEL pixel_value,               /* IN     */
+                            int *stat,                       /* IN     */
+                            spr_attempt_t * attempt,         /* IN/OUT */
+                            int *count)                      /* IN/OUT */
 {
+  int k;
+  int n;
 
-  int rg_value;
-  int row;
-  int col;
-
-  row = igrid_GetNumRows ();
-  col = igrid_GetNumCols ();
-
-  /*
-   * rg_value's MAXIMUM (IF rg_coeff == 100)
-   * WILL BE 1/16 OF THE IMAGE DIMENSIONS. 
-   */
+  if (!IMAGE_PT (i, j))
+  {
+    return FALSE;
+  }
+  k = ran_Bounded (stream, 8);
+  for (n = 0; n < 8; n++)
+  {
+    (*i_nghbr) = i + ring_row[k];
+    (*j_nghbr) = j + ring_col[k];
+    if (IMAGE_PT ((*i_nghbr), (*j_nghbr)))
+    {
+      break;
+    }
+    k = (k + 1) % 8;
+  }
+  return spr_trial_urbanize (stream, (*i_nghbr), (*j_nghbr), z, delta,
+                             slp, excld, pixel_value, stat, attempt, count);
+}
 
-  rg_value = (rg_coeff / MAX_ROAD_VALUE) * ((row + col) / 16.0);
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_trial_merge
+** PURPOSE:       apply the attempts of the parallel trials
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Goes through the trials in order and each trial's
+**                attempts in the order it made them. A success on a
+**                pixel an earlier trial took becomes a delta failure;
+**                the rest are placed and counted as spr_urbanize
+**                would. The order is fixed by the trial numbers, not
+**                by the threads.
+**
+*/
+static void
+  spr_trial_merge (int ntrials,                              /* IN     */
+                   GRID_P delta)                             /* IN/OUT */
+{
+  char func[] = "spr_trial_merge";
+  spr_attempt_t *this_attempt;
+  int t;
+  int k;
 
-  return rg_value;
+  FUNC_INIT;
+  for (t = 0; t < ntrials; t++)
+  {
+    for (k = 0; k < trial_count[t]; k++)
+    {
+      this_attempt = &trial_attempt[t * TRIAL_SLOTS + k];
+      switch (this_attempt->outcome)
+      {
+      case TRIAL_Z_FAILURE:
+        stats_IncrementZFailure ();
+        break;
+      case TRIAL_DELTA_FAILURE:
+        stats_IncrementDeltaFailure ();
+        break;
+      case TRIAL_SLOPE_FAILURE:
+        stats_IncrementSlopeFailure ();
+        break;
+      case TRIAL_EXCLUDED_FAILURE:
+        stats_IncrementEcludedFailure ();
+        break;
+      default:
+        if (delta[this_attempt->offset] != 0)
+        {
+          stats_IncrementDeltaFailure ();
+          break;
+        }
+        delta[this_attempt->offset] = this_attempt->value;
+        growth_offset[growth_count] = this_attempt->offset;
+        growth_count++;
+        (*this_attempt->stat)++;
+        stats_IncrementUrbanSuccess ();
+        break;
+      }
+    }
+  }
+  FUNC_END;
 }
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: spr_urbanize
-** PURPOSE:       try to urbanize a pixel
-** AUTHOR:        Keith Clarke
-** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
-** CREATION DATE: 11/11/1999
+** FUNCTION NAME: spr_phase1n3_trials
+** PURPOSE:       perform phase 1 & 3 growth on every thread
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
 ** DESCRIPTION:
-**
+**                PARALLEL_RANDOM_GROWTH. Each draw of spr_phase1n3 is a
+**                trial with its own ran_KeyedStream, keyed by the draw
+**                number and the year. With ELIGIBLE_CELL_SAMPLING the
+**                draws that miss every eligible cell are skipped first,
+**                on one stream, so only the hits become trials.
 **
 */
-static BOOLEAN
-  spr_urbanize (int row,                                     /* IN     */
-                int col,                                     /* IN     */
-                GRID_P z,                                    /* IN     */
-                GRID_P delta,                                /* IN/OUT */
-                GRID_P slp,                                  /* IN     */
-                GRID_P excld,                                /* IN     */
-                SWGHT_TYPE * swght,                          /* IN     */
-                PIXEL pixel_value,                           /* IN     */
-                int *stat)                                   /* IN/OUT */
+static void
+  spr_phase1n3_trials (COEFF_TYPE diffusion_coefficient,     /* IN     */
+                       COEFF_TYPE breed_coefficient,         /* IN     */
+                       GRID_P z,                             /* IN     */
+                       GRID_P delta,                         /* IN/OUT */
+                       GRID_P slp,                           /* IN     */
+                       GRID_P excld,                         /* IN     */
+                       int *sng,                             /* IN/OUT */
+                       int *sdc)                             /* IN/OUT */
 {
-  char func[] = "spr_urbanize";
-  BOOLEAN val;
+  char func[] = "spr_phase1n3_trials";
+  int k;
+  int t;
+  int ndraws;
+  int ntrials;
+  int skip;
   int nrows;
   int ncols;
-
-  nrows = igrid_GetNumRows ();
-  ncols = igrid_GetNumCols ();
-  assert (nrows > 0);
-  assert (ncols > 0);
+  int year;
+  int monte_carlo;
+  double log_miss;
+  ran_stream_t skip_stream;
+  ran_stream_t *saved_stream;
 
   FUNC_INIT;
-  assert ((row >= 0) && (row < nrows));
-  assert ((col >= 0) && (col < ncols));
   assert (z != NULL);
   assert (delta != NULL);
-  assert (slp != NULL);
-  assert (excld != NULL);
-  assert (swght != NULL);
-  assert (stat != NULL);
+  assert (sng != NULL);
+  assert (sdc != NULL);
 
+  ndraws = 1 + (int) plan.diffusion_value;
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  year = proc_GetCurrentYear ();
+  monte_carlo = ran_GetMonteCarlo ();
+  spr_trial_reserve (ndraws);
 
-  val = FALSE;
-  if (z[OFFSET ((row), (col))] == 0)
+  /*
+   *
+   * NUMBER THE TRIALS
+   *
+   */
+  ntrials = 0;
+  if (elig_cell != NULL)
   {
-    if (delta[OFFSET ((row), (col))] == 0)
+    log_miss = 0.0;
+    if (elig_count < mem_GetTotalPixels ())
     {
-      if (RANDOM_FLOAT > swght[slp[OFFSET ((row), (col))]])
-      {
-        if (excld[OFFSET ((row), (col))] < RANDOM_INT (100))
-        {
-          val = TRUE;
-          delta[OFFSET (row, col)] = pixel_value;
-            if (pixel_value != 0) /** D. Donato 8/14/2006 - If statement added **/
-              {
-               growth_row[growth_count] = row;
-               growth_col[growth_count] = col;
-               growth_count++;
-              }
-
-          (*stat)++;
-          stats_IncrementUrbanSuccess ();
-        }
-        else
-        {
-          stats_IncrementEcludedFailure ();
-        }
-      }
-      else
-      {
-        stats_IncrementSlopeFailure ();
-      }
+      log_miss = log (1.0 - (double) elig_count / mem_GetTotalPixels ());
     }
-    else
+    saved_stream = ran_GetStream ();
+    ran_KeyedStream (&skip_stream, RAN_SUBSTREAM_PHASE1N3, year, -1);
+    ran_SetStream (&skip_stream);
+    for (k = 0; k < ndraws; k++)
     {
-      stats_IncrementDeltaFailure ();
+      skip = spr_eligible_skip (ndraws - k, log_miss);
+      stats_AddSkippedDraws (skip);
+      k += skip;
+      if (k >= ndraws)
+      {
+        break;
+      }
+      trial_index[ntrials++] = k;
     }
+    ran_SetStream (saved_stream);
   }
   else
   {
-    stats_IncrementZFailure ();
+    for (k = 0; k < ndraws; k++)
+    {
+      trial_index[ntrials++] = k;
+    }
   }
 
-  FUNC_END;
+  /*
+   *
+   * RUN THE TRIALS; THE WORK PER TRIAL VARIES, SO THEY ARE HANDED OUT
+   * AS THREADS FREE UP
+   *
+   */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(spr_num_threads ()) \
+  copyin (trial_attempt, trial_count, trial_index, elig_cell, elig_count) \
+  copyin (accept_grid, slope_accept, slope_threshold)
+#endif
+  for (t = 0; t < ntrials; t++)
+  {
+    ran_stream_t stream;
+    spr_attempt_t *attempt;
+    int *count;
+    int i;
+    int j;
+    int i_out;
+    int j_out;
+    int tries;
+    int urbanized;
+
+    attempt = &trial_attempt[t * TRIAL_SLOTS];
+    count = &trial_count[t];
+    *count = 0;
+    ran_ReplicaStream (&stream, RAN_SUBSTREAM_PHASE1N3, year, trial_index[t],
+                       monte_carlo);
+    if (elig_cell != NULL)
+    {
+      i = elig_cell[ran_Bounded (&stream, elig_count)];
+      j = i % ncols;
+      i = i / ncols;
+    }
+    else
+    {
+      i = ran_Bounded (&stream, nrows);
+      j = ran_Bounded (&stream, ncols);
+    }
 
+    if (!INTERIOR_PT (i, j)) continue;
+    if (!spr_trial_urbanize (&stream, i, j, z, delta, slp, excld,
+                             PHASE1G, sng, attempt, count)) continue;
+    if (ran_Bounded (&stream, 101) >= (int) breed_coefficient) continue;
 
-  return val;
+    urbanized = 0;
+    for (tries = 0; tries < 8; tries++)
+    {
+      if (spr_trial_urbanize_nghbr (&stream, i, j, &i_out, &j_out, z, delta,
+                                    slp, excld, PHASE3G, sdc, attempt, count))
+      {
+        urbanized++;
+        if (urbanized == MIN_NGHBR_TO_SPREAD)
+        {
+          break;
+        }
+      }
+    }
+  }
+
+  spr_trial_merge (ntrials, delta);
+  FUNC_END;
 }
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: spr_get_neighbor
-** PURPOSE:       find a neighboring pixel
-** AUTHOR:        Keith Clarke
-** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
-** CREATION DATE: 11/11/1999
+** FUNCTION NAME: spr_phase5_trials
+** PURPOSE:       perform phase 5 growth on every thread
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
 ** DESCRIPTION:
-**
+**                PARALLEL_RANDOM_GROWTH. Each road trip of spr_phase5
+**                is a trial with its own ran_KeyedStream, keyed by the
+**                trip number and the year. The trips start from the
+**                growth of phases 1 to 4, which the merge only appends
+**                to, and the road search band is found once up front.
 **
 */
-static
-  void
-  spr_get_neighbor (int i_in,                                /* IN     */
-                    int j_in,                                /* IN     */
-                    int *i_out,                              /* OUT    */
-                    int *j_out)                              /* OUT    */
+static void
+  spr_phase5_trials (COEFF_TYPE road_gravity,                /* IN     */
+                     COEFF_TYPE diffusion_coefficient,       /* IN     */
+                     COEFF_TYPE breed_coefficient,           /* IN     */
+                     GRID_P z,                               /* IN     */
+                     GRID_P delta,                           /* IN/OUT */
+                     GRID_P slp,                             /* IN     */
+                     GRID_P excld,                           /* IN     */
+                     GRID_P roads,                           /* IN     */
+                     int *rt)                                /* IN/OUT */
 {
-  char func[] = "spr_get_neighbor";
-  int i;
-  int j;
-  int k;
-  int nrows;
+  char func[] = "spr_phase5_trials";
+  int t;
+  int ntrials;
+  int band;
+  int growth_count_fixed;
+  int year;
+  int monte_carlo;
   int ncols;
 
-  nrows = igrid_GetNumRows ();
+  FUNC_INIT;
+  assert (z != NULL);
+  assert (delta != NULL);
+  assert (roads != NULL);
+  assert (rt != NULL);
   ncols = igrid_GetNumCols ();
-  assert (nrows > 0);
-  assert (ncols > 0);
 
-  FUNC_INIT;
-  assert (nrows > i_in);
-  assert (ncols > j_in);
-  assert (0 <= i_in);
-  assert (0 <= j_in);
-  assert (i_out != NULL);
-  assert (j_out != NULL);
+  if (growth_count == 0)
+  {
+    FUNC_END;
+    return;
+  }
 
-  util_get_next_neighbor (i_in, j_in, i_out, j_out, RANDOM_INT (8));
-  for (k = 0; k < 8; k++)
+  if (aux_breed_coeff >= 0)
+  {
+    road_growth_breed_coefficient = aux_breed_coeff;
+  }
+  else
+  {
+    road_growth_breed_coefficient = - aux_breed_coeff * breed_coefficient;
+  }
+  if (aux_diffusion_coeff >= 0)
+  {
+    road_growth_diffusion_coefficient = aux_diffusion_coeff;
+  }
+  else
+  {
+    road_growth_diffusion_coefficient = - aux_diffusion_coeff * diffusion_coefficient;
+  }
+
+  int_road_gravity = plan.road_grav_value;
+  band = plan.road_band;
+
+  ntrials = 1 + (int) road_growth_breed_coefficient;
+  growth_count_fixed = growth_count;
+  year = proc_GetCurrentYear ();
+  monte_carlo = ran_GetMonteCarlo ();
+  spr_trial_reserve (ntrials);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(spr_num_threads ()) \
+  copyin (trial_attempt, trial_count, growth_offset) \
+  copyin (accept_grid, slope_accept, slope_threshold) \
+  copyin (road_growth_diffusion_coefficient, rpoIndex) \
+  copyin (rporow_ptrMin, rporow_ptrMax, rporow_ptrIdx, rpocol_ptr) \
+  copyin (rponear_ptr, rponearCol, rponearIdx, rponearList) \
+  copyin (rponodeOff, rponodeNbr, rponodeMask, rponodeVal)
+#endif
+  for (t = 0; t < ntrials; t++)
   {
-    i = (*i_out);
-    j = (*j_out);
-    if (IMAGE_PT (i, j))
+    ran_stream_t stream;
+    spr_attempt_t *attempt;
+    int *count;
+    int growth_index;
+    int i_rd_start;
+    int j_rd_start;
+    int i_rd_end;
+    int j_rd_end;
+    int i_rd_end_nghbr;
+    int j_rd_end_nghbr;
+    int i_rd_end_nghbr_nghbr;
+    int j_rd_end_nghbr_nghbr;
+    int tries;
+
+    attempt = &trial_attempt[t * TRIAL_SLOTS];
+    count = &trial_count[t];
+    *count = 0;
+    ran_ReplicaStream (&stream, RAN_SUBSTREAM_PHASE5, year, t, monte_carlo);
+    growth_index = ran_Bounded (&stream, growth_count_fixed);
+
+    if (!spr_road_nearest (growth_offset[growth_index] / ncols,
+                           growth_offset[growth_index] % ncols,
+                           band, &i_rd_start, &j_rd_start)) continue;
+    if (!spr_road_walk (i_rd_start, j_rd_start, &i_rd_end, &j_rd_end, roads,
+                        road_growth_diffusion_coefficient, &stream)) continue;
+    if (!spr_trial_urbanize_nghbr (&stream, i_rd_end, j_rd_end,
+                                   &i_rd_end_nghbr, &j_rd_end_nghbr,
+                                   z, delta, slp, excld,
+                                   PHASE5G, rt, attempt, count)) continue;
+    for (tries = 0; tries < 3; tries++)
     {
-      break;
+      spr_trial_urbanize_nghbr (&stream, i_rd_end_nghbr, j_rd_end_nghbr,
+                                &i_rd_end_nghbr_nghbr, &j_rd_end_nghbr_nghbr,
+                                z, delta, slp, excld,
+                                PHASE5G, rt, attempt, count);
     }
-    util_get_next_neighbor (i_in, j_in, i_out, j_out, -1);
   }
+
+  spr_trial_merge (ntrials, delta);
   FUNC_END;
 }
 
 /******************************************************************************
 *******************************************************************************
-** FUNCTION NAME: spr_urbanize_nghbr
-** PURPOSE:       try to urbanize a neighbor
+** FUNCTION NAME: spr_get_slp_weights
+** PURPOSE:       calculate the slope weights
 ** AUTHOR:        Keith Clarke
 ** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
 ** CREATION DATE: 11/11/1999
@@ -1045,19 +1980,438 @@ static
 **
 **
 */
-static
-    BOOLEAN
-  spr_urbanize_nghbr (int i,                                 /* IN     */
-                      int j,                                 /* IN     */
-                      int *i_nghbr,                          /* OUT    */
-                      int *j_nghbr,                          /* OUT    */
-                      GRID_P z,                              /* IN     */
-                      GRID_P delta,                          /* IN/OUT */
-                      GRID_P slp,                            /* IN     */
-                      GRID_P excld,                          /* IN     */
-                      SWGHT_TYPE * swght,                    /* IN     */
-                      PIXEL pixel_value,                     /* IN     */
-                      int *stat)                             /* IN/OUT */
+static void
+  spr_get_slp_weights (int array_size,                       /* IN     */
+                       SWGHT_TYPE * lut)                     /* OUT    */
+{
+  char func[] = "spr_get_slp_weights";
+  float val;
+  float exp;
+  int i;
+
+  FUNC_INIT;
+  assert (lut != NULL);
+
+  exp = coeff_GetCurrentSlopeResist () / (MAX_SLOPE_RESISTANCE_VALUE / 2.0);
+  for (i = 0; i < array_size; i++)
+  {
+    if (i < scen_GetCriticalSlope ())
+    {
+      val = (scen_GetCriticalSlope () - (SWGHT_TYPE) i) / scen_GetCriticalSlope ();
+      lut[i] = 1.0 - pow (val, exp);
+    }
+    else
+    {
+      lut[i] = 1.0;
+    }
+    ran_SetThreshold (&slope_threshold[i], lut[i]);
+  }
+  if (scen_GetLogFlag ())
+  {
+    if (scen_GetLogSlopeWeightsFlag ())
+    {
+      scen_Append2Log ();
+      spr_LogSlopeWeights (scen_GetLogFP (), array_size, lut);
+      scen_CloseLog ();
+    }
+  }
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_plan_update
+** PURPOSE:       rebuild the spread plan if the coefficients changed
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   The diffusion value, the road gravity value and the
+**                road search index and band that follow from it, and
+**                the slope weights (with their thresholds) depend only
+**                on the current coefficients and the grid size. They
+**                are kept from year to year and across Monte Carlo
+**                iterations until coeff_GetCurrentGeneration changes.
+**                Rebuilds are timed as "spr_plan", so the timing log
+**                shows how often they happen.
+**
+*/
+static void
+  spr_plan_update ()
+{
+  char func[] = "spr_plan_update";
+
+  FUNC_INIT;
+  if (plan.built && (plan.generation == coeff_GetCurrentGeneration ()))
+  {
+    FUNC_END;
+    return;
+  }
+  timer_Start (SPR_PLAN);
+  plan.diffusion_value =
+    spr_GetDiffusionValue (coeff_GetCurrentDiffusion ());
+  plan.road_grav_value =
+    spr_GetRoadGravValue (coeff_GetCurrentRoadGravity ());
+  plan.max_search_index =
+    4 * (plan.road_grav_value * (1 + plan.road_grav_value));
+  plan.max_search_index = MAX (plan.max_search_index, igrid_GetNumRows ());
+  plan.max_search_index = MAX (plan.max_search_index, igrid_GetNumCols ());
+  plan.road_band = spr_road_band (plan.max_search_index);
+  spr_get_slp_weights (SLOPE_WEIGHT_ARRAY_SZ,                /* IN     */
+                       plan.swght);                          /* OUT    */
+  plan.generation = coeff_GetCurrentGeneration ();
+  plan.built = TRUE;
+  timer_Stop (SPR_PLAN);
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_build_accept_grid
+** PURPOSE:       fuse slope weight and exclusion into one threshold grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   spr_urbanize accepts a pixel when RANDOM_FLOAT > swght
+**                and then excld < RANDOM_INT (100), i.e. with probability
+**                (1 - swght) * (99 - excld) / 100. Both factors are stored
+**                scaled to ACCEPT_SCALE: the slope factor per slope value,
+**                the product per pixel. The slope and excluded grids never
+**                change, so the grid only needs rebuilding when the slope
+**                resistance does.
+**
+*/
+static void
+  spr_build_accept_grid (GRID_P slp,                         /* IN     */
+                         GRID_P excld,                       /* IN     */
+                         SWGHT_TYPE * swght)                 /* IN     */
+{
+  char func[] = "spr_build_accept_grid";
+  int i;
+  int total_pixels;
+  double pass;
+
+  FUNC_INIT;
+  assert (slp != NULL);
+  assert (excld != NULL);
+  assert (swght != NULL);
+
+  for (i = 0; i < SLOPE_WEIGHT_ARRAY_SZ; i++)
+  {
+    slope_accept[i] =
+      (unsigned short) ((1.0 - swght[i]) * ACCEPT_SCALE + 0.5);
+  }
+  total_pixels = mem_GetTotalPixels ();
+  for (i = 0; i < total_pixels; i++)
+  {
+    pass = 0.0;
+    if (excld[i] < 99)
+    {
+      pass = (1.0 - swght[slp[i]]) * (99 - excld[i]) / 100.0;
+    }
+    accept_grid[i] = (unsigned short) (pass * ACCEPT_SCALE + 0.5);
+  }
+  FUNC_END;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_LogSlopeWeights
+** PURPOSE:       log slope weights to FILE * fp
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**
+**
+*/
+static void
+  spr_LogSlopeWeights (FILE * fp, int array_size, SWGHT_TYPE * lut)
+{
+  int i;
+
+  assert (fp != NULL);
+  assert (array_size > 0);
+  assert (lut != NULL);
+
+  fprintf (fp, "\n%s %5u ***** LOG OF SLOPE WEIGHTS *****\n",
+           __FILE__, __LINE__);
+  fprintf (fp, "%s %5u CRITICAL_SLOPE= %f\n",
+           __FILE__, __LINE__, scen_GetCriticalSlope ());
+  fprintf (fp, "%s %5u coeff_GetCurrentSlopeResist= %f\n",
+           __FILE__, __LINE__, coeff_GetCurrentSlopeResist ());
+  fprintf (fp, "%s %5u MAX_SLOPE_RESISTANCE_VALUE= %f\n",
+           __FILE__, __LINE__, MAX_SLOPE_RESISTANCE_VALUE);
+  for (i = 0; i < array_size; i++)
+  {
+    if (i < scen_GetCriticalSlope ())
+    {
+      fprintf (fp, "%s %5u lut[%3u]= %f\n",
+               __FILE__, __LINE__, i, lut[i]);
+    }
+  }
+  fprintf (fp, "All values other values to lut[%u] = 1.000000\n", array_size);
+
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_GetDiffusionValue
+** PURPOSE:       calculate the diffusion value
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**
+**
+*/
+static COEFF_TYPE
+  spr_GetDiffusionValue (COEFF_TYPE diffusion_coeff)
+{
+
+  COEFF_TYPE diffusion_value;
+  double rows_sq;
+  double cols_sq;
+
+  rows_sq = igrid_GetNumRows () * igrid_GetNumRows ();
+  cols_sq = igrid_GetNumCols () * igrid_GetNumCols ();
+
+    /*VerD*/
+  /*
+   * diffusion_value's MAXIMUM (IF diffusion_coeff == 100)
+   * WILL BE 5% OF THE IMAGE DIAGONAL.
+   *  (unless overridden by AUX_DIFFUSION_MULT in scenario file)
+   */
+
+	if (aux_diffusion_mult <= 0)
+	{
+		diffusion_value = ((diffusion_coeff * 0.005) * sqrt (rows_sq + cols_sq));
+	}
+	else
+	{
+		diffusion_value = ((diffusion_coeff * aux_diffusion_mult) * sqrt (rows_sq + cols_sq));
+	}
+
+    /*VerD*/
+
+  return diffusion_value;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_GetRoadGravValue
+** PURPOSE:       calculate the road gravity value
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**
+**
+*/
+static COEFF_TYPE
+  spr_GetRoadGravValue (COEFF_TYPE rg_coeff)
+{
+
+  int rg_value;
+  int row;
+  int col;
+
+  row = igrid_GetNumRows ();
+  col = igrid_GetNumCols ();
+
+  /*
+   * rg_value's MAXIMUM (IF rg_coeff == 100)
+   * WILL BE 1/16 OF THE IMAGE DIMENSIONS. 
+   */
+
+  rg_value = (rg_coeff / MAX_ROAD_VALUE) * ((row + col) / 16.0);
+
+  return rg_value;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_urbanize
+** PURPOSE:       try to urbanize a pixel
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**
+**
+*/
+static BOOLEAN
+  spr_urbanize (int row,                                     /* IN     */
+                int col,                                     /* IN     */
+                GRID_P z,                                    /* IN     */
+                GRID_P delta,                                /* IN/OUT */
+                GRID_P slp,                                  /* IN     */
+                GRID_P excld,                                /* IN     */
+                SWGHT_TYPE * swght,                          /* IN     */
+                PIXEL pixel_value,                           /* IN     */
+                int *stat)                                   /* IN/OUT */
+{
+  char func[] = "spr_urbanize";
+  BOOLEAN val;
+  int draw;
+
+  FUNC_INIT;
+  assert (IMAGE_PT (row, col));
+  assert (z != NULL);
+  assert (delta != NULL);
+  assert (slp != NULL);
+  assert (excld != NULL);
+  assert (swght != NULL);
+  assert (stat != NULL);
+
+
+  val = FALSE;
+  if (z[OFFSET ((row), (col))] == 0)
+  {
+    if (delta[OFFSET ((row), (col))] == 0)
+    {
+      if (accept_grid != NULL)
+      {
+        /*
+         * ONE DRAW DECIDES BOTH TESTS: BELOW THE FUSED THRESHOLD IS A
+         * SUCCESS, BELOW THE SLOPE THRESHOLD AN EXCLUSION FAILURE
+         */
+        draw = ran_Bounded (ran_stream, ACCEPT_SCALE);
+        if (draw < accept_grid[OFFSET ((row), (col))])
+        {
+          val = TRUE;
+        }
+        else if (draw < slope_accept[slp[OFFSET ((row), (col))]])
+        {
+          stats_IncrementEcludedFailure ();
+        }
+        else
+        {
+          stats_IncrementSlopeFailure ();
+        }
+      }
+      else if (ran_Exceeds (ran_stream, &slope_threshold[slp[OFFSET ((row), (col))]]))
+      {
+        if (excld[OFFSET ((row), (col))] < RANDOM_INT (100))
+        {
+          val = TRUE;
+        }
+        else
+        {
+          stats_IncrementEcludedFailure ();
+        }
+      }
+      else
+      {
+        stats_IncrementSlopeFailure ();
+      }
+      if (val)
+      {
+        delta[OFFSET (row, col)] = pixel_value;
+          if (pixel_value != 0) /** D. Donato 8/14/2006 - If statement added **/
+            {
+             growth_offset[growth_count] = OFFSET (row, col);
+             growth_count++;
+            }
+
+        (*stat)++;
+        stats_IncrementUrbanSuccess ();
+      }
+    }
+    else
+    {
+      stats_IncrementDeltaFailure ();
+    }
+  }
+  else
+  {
+    stats_IncrementZFailure ();
+  }
+
+  FUNC_END;
+
+
+  return val;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_get_neighbor
+** PURPOSE:       find a neighboring pixel
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**
+**
+*/
+static
+  void
+  spr_get_neighbor (int i_in,                                /* IN     */
+                    int j_in,                                /* IN     */
+                    int *i_out,                              /* OUT    */
+                    int *j_out)                              /* OUT    */
+{
+  char func[] = "spr_get_neighbor";
+  int i;
+  int j;
+  int k;
+  int nrows;
+  int ncols;
+
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  assert (nrows > 0);
+  assert (ncols > 0);
+
+  FUNC_INIT;
+  assert (nrows > i_in);
+  assert (ncols > j_in);
+  assert (0 <= i_in);
+  assert (0 <= j_in);
+  assert (i_out != NULL);
+  assert (j_out != NULL);
+
+  util_get_next_neighbor (i_in, j_in, i_out, j_out, RANDOM_INT (8));
+  /* every neighbor of an interior pixel is on the image */
+  if ((i_in == 0) || (i_in == nrows - 1) || (j_in == 0) || (j_in == ncols - 1))
+  {
+    for (k = 0; k < 8; k++)
+    {
+      i = (*i_out);
+      j = (*j_out);
+      if (IMAGE_PT (i, j))
+      {
+        break;
+      }
+      util_get_next_neighbor (i_in, j_in, i_out, j_out, -1);
+    }
+  }
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_urbanize_nghbr
+** PURPOSE:       try to urbanize a neighbor
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**
+**
+*/
+static
+    BOOLEAN
+  spr_urbanize_nghbr (int i,                                 /* IN     */
+                      int j,                                 /* IN     */
+                      int *i_nghbr,                          /* OUT    */
+                      int *j_nghbr,                          /* OUT    */
+                      GRID_P z,                              /* IN     */
+                      GRID_P delta,                          /* IN/OUT */
+                      GRID_P slp,                            /* IN     */
+                      GRID_P excld,                          /* IN     */
+                      SWGHT_TYPE * swght,                    /* IN     */
+                      PIXEL pixel_value,                     /* IN     */
+                      int *stat)                             /* IN/OUT */
 {
   char func[] = "spr_urbanize_nghbr";
   BOOLEAN status = FALSE;
@@ -1102,7 +2456,9 @@ static
 ** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
 ** CREATION DATE: 11/11/1999
 ** DESCRIPTION:
-**
+**                Draws from the stream it is given. The parallel road
+**                trips call it from any thread, so it does not push
+**                the call stack.
 **
 */
 static
@@ -1112,57 +2468,79 @@ static
                  int *i_road_end,                            /* OUT    */
                  int *j_road_end,                            /* OUT    */
                  GRID_P roads,                               /* IN     */
-                 double diffusion_coefficient)               /* IN     */
+                 double diffusion_coefficient,               /* IN     */
+                 ran_stream_t * stream)                      /* IN/OUT */
 {
-  char func[] = "spr_road_walk";
   int i;
   int j;
-  int i_nghbr;
-  int j_nghbr;
   int k;
+  int node;
+  int mask;
   BOOLEAN end_of_road;
   BOOLEAN spread = FALSE;
   int run_value;
   int run = 0;
+  int start_nbr[8];
 
-  FUNC_INIT;
   assert (i_road_end != NULL);
   assert (j_road_end != NULL);
   assert (roads != NULL);
 
+  /*
+   * WALK THE ROAD GRAPH (spr_rpoGraph). THE WALK MOVES TO THE FIRST
+   * ROAD NEIGHBOR FOUND GOING ROUND THE PIXEL FROM A RANDOM DIRECTION,
+   * AS util_get_next_neighbor ENUMERATES THEM. THE START PIXEL IS NOT
+   * ALWAYS A ROAD PIXEL, SO ITS NEIGHBORS ARE LOOKED UP.
+   */
   i = i_road_start;
   j = j_road_start;
-  end_of_road = FALSE;
-  while (!end_of_road)
+  node = spr_rpoNode (rpoIndex, i, j);
+  mask = 0;
+  if (node < 0)
   {
-    end_of_road = TRUE;
-    util_get_next_neighbor (i, j, &i_nghbr, &j_nghbr, RANDOM_INT (8));
     for (k = 0; k < 8; k++)
     {
-      if (IMAGE_PT (i_nghbr, j_nghbr))
+      start_nbr[k] = -1;
+      if (IMAGE_PT (i + ring_row[k], j + ring_col[k]))
       {
-        if (roads[OFFSET (i_nghbr, j_nghbr)])
+        start_nbr[k] = spr_rpoNode (rpoIndex, i + ring_row[k], j + ring_col[k]);
+        if (start_nbr[k] >= 0)
         {
-          end_of_road = FALSE;
-          run++;
-          i = i_nghbr;
-          j = j_nghbr;
-          break;
+          mask |= (1 << k);
         }
       }
-      util_get_next_neighbor (i, j, &i_nghbr, &j_nghbr, -1);
     }
-    run_value = (int) (roads[OFFSET (i, j)] / MAX_ROAD_VALUE *
+  }
+  end_of_road = FALSE;
+  while (!end_of_road)
+  {
+    end_of_road = TRUE;
+    if (node >= 0)
+    {
+      mask = rponodeMask[node];
+    }
+    k = walk_turn[ran_Bounded (stream, 8)][mask];
+    if (k >= 0)
+    {
+      end_of_road = FALSE;
+      run++;
+      node = (node >= 0) ? rponodeNbr[8 * node + k] : start_nbr[k];
+    }
+    run_value = (int) (((node >= 0) ? rponodeVal[node] : 0) / MAX_ROAD_VALUE *
                        diffusion_coefficient);
     if (run > run_value)
     {
       end_of_road = TRUE;
       spread = TRUE;
+      if (node >= 0)
+      {
+        i = rponodeOff[node] / igrid_GetNumCols ();
+        j = rponodeOff[node] % igrid_GetNumCols ();
+      }
       (*i_road_end) = i;
       (*j_road_end) = j;
     }
   }
-  FUNC_END;
   return spread;
 }
 
@@ -1179,136 +2557,261 @@ static
 */
 static
     BOOLEAN
-  spr_road_search (short i_grwth_center,                     /* IN     */
-                   short j_grwth_center,                     /* IN     */
+  spr_road_search (int i_grwth_center,                       /* IN     */
+                   int j_grwth_center,                       /* IN     */
                    int *i_road,                              /* OUT    */
                    int *j_road,                              /* OUT    */
                    int max_search_index,                     /* IN     */
                    GRID_P roads)                             /* IN     */
 {
   char func[] = "spr_road_search";
-  int i;
-  int j;
-  int i_offset;
-  int j_offset;
-  BOOLEAN road_found = FALSE;
-  int srch_index;
-/***                          D.D. July 28, 2006               (Begin)       **/
-/***  New variables for the new road-search algorithm                        **/
-  BOOLEAN bn_found;
-  int bn, tcount, total, N, k, kmax, kmin, ktest, n, r;
-  int crow, ccol, trow, brow, lcol, rcol, nrows, ncols, srow;
-  FILE *DD01DBG;
-/*******************          D.D. July 28, 2006      (End)  ******************/
+  BOOLEAN road_found;
 
   FUNC_INIT;
   assert (i_road != NULL);
   assert (j_road != NULL);
   assert (max_search_index >= 0);
 
-/***                          D.D. July 28, 2006               (Begin)       **/
-/***  Set the variables to define the search area.                           **/
+  road_found = spr_road_nearest (i_grwth_center,
+                                 j_grwth_center,
+                                 spr_road_band (max_search_index),
+                                 i_road,
+                                 j_road);
+
+  FUNC_END;
+  return road_found;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_road_band
+** PURPOSE:       find the road search band
+** AUTHOR:        David I. Donato
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Split out of spr_road_search so the parallel road
+**                trips can find the band once, before they start.
+**
+**
+*/
+static int
+  spr_road_band (int max_search_index)                       /* IN     */
+{
+  char func[] = "spr_road_band";
+  BOOLEAN bn_found;
+  int bn, N, n, total, nrows, ncols;
+
+  FUNC_INIT;
   nrows = igrid_GetNumRows();
   ncols = igrid_GetNumCols();
-  crow  = i_grwth_center;
-  ccol  = j_grwth_center;
 
-  /*** Find the maximal search radius bn. Set N = bn. ***/
-  N = MAX (max_search_index, nrows);
-  N = MAX (max_search_index, ncols);
-  n = ( (int) (sqrt((float)(N/4)) ) - 1);/** Choose an efficient starting   **/
-  if (n < 1) {n = 1;}                    /** value for iteration to find bn.**/
-  bn_found = FALSE;
-  for (bn = n; bn < MAX (ncols, nrows); bn++)
+  /*** Find the maximal search radius bn. Set N = bn.  bn only depends  ***/
+  /*** on max_search_index, which is fixed for a spr_spread call, so the ***/
+  /*** last one found is reused.                                         ***/
+  if (max_search_index != bn_search_index)
   {
-    total = 4 * ((1 + bn) * bn);
-    if (total > N)
+    N = MAX (max_search_index, nrows);
+    N = MAX (max_search_index, ncols);
+    n = ( (int) (sqrt((float)(N/4)) ) - 1);/** Choose an efficient starting   **/
+    if (n < 1) {n = 1;}                    /** value for iteration to find bn.**/
+    bn_found = FALSE;
+    for (bn = n; bn < MAX (ncols, nrows); bn++)
     {
-      bn_found = TRUE;
-      break;
+      total = 4 * ((1 + bn) * bn);
+      if (total > N)
+      {
+        bn_found = TRUE;
+        break;
+      }
     }
+    if (!bn_found)
+    {
+      sprintf (msg_buf, "Unable to find road search band bn in new RS algorithm.");
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+    bn_search_index = max_search_index;
+    bn_cached = bn;
   }
-  if (!bn_found)
-  {
-    sprintf (msg_buf, "Unable to find road search band bn in new RS algorithm.");
-    LOG_ERROR (msg_buf);
-    EXIT (1);
-  }
-  else
-  {N = bn;}
-
-  /** Set trow, brow, lcol, and rcol based on N. **/
-  if (crow >= N)               {trow = crow - N;} else {trow = 0;}
-  if (crow <= (nrows - 1 - N)) {brow = crow + N;} else {brow = nrows - 1;}
-  if (ccol >= N)               {lcol = ccol - N;} else {lcol = 0;}
-  if (ccol <= ncols - 1 - N)   {rcol = ccol + N;} else {rcol = ncols - 1;}
-
-
-/*******************          D.D. July 28, 2006      (End)  ******************/
-
-/***                          D.D. July 28, 2006               (Begin)       **/
-/***  Search for road pixels                                                 **/
-
-  foundN = -1;   /** Set the "road-pixel-found" indicator to "none found". **/
-
-  for (srow=0; srow<=N; srow++)
-       {
-        tfoundN = -1;  /** Pre-set the temporary indicator to "not found". **/
-
-        for (i=1; i<=2; i++ )  /** Process the rows srow above and srow below crow. **/
-             {
-              if (i == 1) {r = crow - srow;} else {r = crow + srow;}
-              /** Process the first row containing the search center only once.     **/
-              if (srow == 0 && i == 2) {break;}
 
-              /** Don't waste time processing a row if it is above or below the
-                  search area; if it  contains no road pixels; or if there is no
-                  overlap between the section with road pixels and the search area. **/
-
-              if (r < trow || r > brow)     {continue;}
-              if (rporow_ptrNum[r] == 0)    {continue;}
-              if (rporow_ptrMin[r] > rcol)  {continue;}
-              if (rporow_ptrMax[r] < lcol)  {continue;}
+  FUNC_END;
+  return bn_cached;
+}
 
-              /** Perform a binary search to find the road pixel in this row
-                  which is closest to the search center.                            **/
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_road_nearest
+** PURPOSE:       find the nearest road pixel within a band
+** AUTHOR:        David I. Donato
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   The search of spr_road_search within band N of
+**                (crow, ccol), answered from the nearest-road index
+**                spr_rpoNearest builds. Keeps its state in locals and
+**                does not push the call stack, so the parallel road
+**                trips may call it from any thread.
+**
+**                The lookup is a binary search of the row's runs, a
+**                few per road pixel, rather than a read of one entry
+**                per pixel: a pixel table would cost 4 bytes per pixel
+**                for each of up to 15 road grids, while the runs of a
+**                row take a handful of cached steps whatever N is.
+*/
+static BOOLEAN
+  spr_road_nearest (int crow,                                /* IN     */
+                    int ccol,                                /* IN     */
+                    int N,                                   /* IN     */
+                    int *i_road,                             /* OUT    */
+                    int *j_road)                             /* OUT    */
+{
+  int i;
+  BOOLEAN road_found = FALSE;
+  int k;
+  int lo, hi, mid;
+  int ncols;
+  int foundN, foundRow, foundCol;
 
-              kmin = 0; kmax = rporow_ptrNum[r] - 1;
-              tcount = 0;
-              while ((kmax - kmin) > 1)
-                   {
-                    ktest = (kmax + kmin)/2;
-                    if (WCOL(r,ktest) <= ccol) {kmin = ktest;}
-                    else                       {kmax = ktest;}
-                    tcount++;
-                   }
+  ncols = igrid_GetNumCols();
+  foundRow = crow;
+  foundCol = ccol;
+
+  /*** Look the answer up in the nearest-road runs of the row         ***/
+  /*** (spr_rpoNearest). A run below -1 starts a candidate list: the   ***/
+  /*** first entry whose band radius N reaches is the answer.          ***/
+  lo = rponearIdx[crow]; hi = rponearIdx[crow + 1] - 1;
+  while (lo < hi)
+  {
+    mid = (lo + hi + 1) / 2;
+    if (rponearCol[mid] <= ccol) {lo = mid;}
+    else                         {hi = mid - 1;}
+  }
+  k = rponear_ptr[lo];
+  if (k < -1)
+  {
+    i = -(k + 2);
+    while (rponearList[i + 1] > N) {i += 2;}
+    k = rponearList[i];
+  }
+  if (k >= 0)
+  {
+    foundRow = k / ncols;
+    foundCol = k % ncols;
+    foundN = MAX (abs (foundRow - crow), abs (foundCol - ccol));
+    if (foundN <= N) road_found = TRUE;
+  }
+  (*i_road) = foundRow;  (*j_road) = foundCol;
 
-              if ( (WCOL(r,kmax) - ccol) < (ccol - WCOL(r,kmin)) )
-                   {k = kmax;} else {k = kmin;}
-              tfoundN = MAX( srow, abs(WCOL(r,k) - ccol));
-              tfoundRow = r; tfoundCol = WCOL(r,k);
+  return road_found;
+}
 
-              /** Now save the best point found in this row if it is
-                  closer to the center than the previous best point. ***/
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_road_select
+** PURPOSE:       make the road search structures of a road grid current
+** AUTHOR:        David I. Donato
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Split out of spr_spread so spr_SpreadReplica can use
+**                the road search and road walk too.
+**
+**
+*/
+static void
+  spr_road_select (GRID_P roads)                             /* IN     */
+{
+/***                          D.D. July 28, 2006               (Begin)       **/
+/***  Call the routine to initialize the array of pointers to road grids.    **/
 
-              if ( (foundN < 0 && tfoundN > 0) || (foundN > 0 && tfoundN > 0 && tfoundN < foundN)) 
-                   { foundN = tfoundN; foundRow = tfoundRow; foundCol = tfoundCol; }
-             }
+  spr_rpoList_Init();  /* Only runs on the first call */
 
-        /** If the point found is in the current search band (n = srow) then
-        this point is the closest road pixel to the search center
-        and there is no need to continue iterating through the remaining
-        rows.                                                            ***/
+/*******************          D.D. July 28, 2006      (End)  ******************/
 
-        if (foundN == srow) {break;}
-       }
+/***                          D.D. July 28, 2006               (Begin)       **/
+/*** Identify the correct files for road pixels. Create files if necessary.  **/
+  for (rpoIndex=0; rpoIndex<scen_GetRoadDataFileCount(); rpoIndex++)
+     {
+      if (rpoList[rpoIndex] == roads)
+           {
+            if (rpoStatus[rpoIndex] == 1) break;
+            spr_rpoPopulate(rpoIndex);
+            break;
+           }
+     }
+  if (rpoStatus[rpoIndex] != 1) 
+/*******************          D.D. July 28, 2006      (End)  ******************/
 
+/***                          D.D. July 28, 2006               (Begin)       **/
+/*** Set the road-pixel-only row pointers for the current road grid.         **/
+  rporow_ptrNum =  mem_GetRPOrowptrNum(rpoIndex);
+  rporow_ptrMin =  mem_GetRPOrowptrMin(rpoIndex);
+  rporow_ptrMax =  mem_GetRPOrowptrMax(rpoIndex);
+  rporow_ptrIdx =  mem_GetRPOrowptrIdx(rpoIndex);
+  rpocol_ptr    =  mem_GetRPOcolptr(rpoIndex);
+/*******************          D.D. July 28, 2006      (End)  ******************/
+  rponodeOff    =  mem_GetRPOnodeOffptr(rpoIndex);
+  rponodeNbr    =  mem_GetRPOnodeNbrptr(rpoIndex);
+  rponodeMask   =  mem_GetRPOnodeMaskptr(rpoIndex);
+  rponodeVal    =  mem_GetRPOnodeValptr(rpoIndex);
+  if (rponearNum[rpoIndex] != rporow_ptrNum) spr_rpoNearest(rpoIndex);
+  rponear_ptr   =  mem_GetRPOnearptr(rpoIndex);
+  rponearCol    =  mem_GetRPOnearColptr(rpoIndex);
+  rponearIdx    =  mem_GetRPOnearIdxptr(rpoIndex);
+  rponearList   =  mem_GetRPOnearListptr(rpoIndex);
+}
 
-  if ( foundN >= 0 && foundN <= N ) road_found = TRUE; 
-  (*i_road) = foundRow;  (*j_road) = foundCol;
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_SettleRoads
+** PURPOSE:       build the road search structures growth from
+**                first_year to last_year will use
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                spr_road_select builds a road grid's structures the
+**                first time it is used and keeps rporow_ptrNum from the
+**                last one built, so an iteration that builds one grows
+**                differently from the ones after it. Returns FALSE,
+**                having built nothing, if a road grid of the years is
+**                not built yet; otherwise builds the nearest-road index
+**                each one will need, so the threads of a
+**                PARALLEL_MONTE_CARLO pool only read the structures.
+**
+*/
+BOOLEAN
+  spr_SettleRoads (int first_year,                           /* IN     */
+                   int last_year)                            /* IN     */
+{
+  char func[] = "spr_SettleRoads";
+  GRID_P roads;
+  int year;
+  int i;
 
-  FUNC_END;
-  return road_found;
+  spr_rpoList_Init();
+  for (year = first_year + 1; year <= last_year; year++)
+  {
+    roads = igrid_GetRoadGridPtrByYear (__FILE__, func, __LINE__, year);
+    for (i=0; i<scen_GetRoadDataFileCount(); i++)
+    {
+      if (rpoList[i] == roads)
+      {
+        break;
+      }
+    }
+    roads = igrid_GridRelease (__FILE__, func, __LINE__, roads);
+    if ((i == scen_GetRoadDataFileCount()) || (rpoStatus[i] != 1))
+    {
+      return FALSE;
+    }
+  }
+  for (i=0; i<scen_GetRoadDataFileCount(); i++)
+  {
+    if ((rpoStatus[i] == 1) && (rponearNum[i] != rporow_ptrNum))
+    {
+      spr_rpoNearest(i);
+    }
+  }
+  return TRUE;
 }
 
 /******************************************************************************
@@ -1338,17 +2841,18 @@ void
   char func[] = "Spread";
 /*GRID_P delta;   D.D. 8/29/2006 */
   int i;
-  int total_pixels;
-  int nrows;
   int ncols;
+  int row;
+  int col;
 
-/* D.D. 8/18/2006 */
-  int   row,col, colindex;
-  short *ExcPixRow;
-  short *ExcPixCol;
-  short *UrbPixRow;
-  short *UrbPixCol;
-/* D.D. 8/18/2006 */
+  int offset;
+  int zgrwth_first;
+  double slope_sum;
+  double xsum;
+  double ysum;
+  GRID_P nbrcount;
+  MASK_WORD *zmask;
+  int wpr;
 
   double road_gravity;
   COEFF_TYPE diffusion_coefficient;
@@ -1362,11 +2866,10 @@ void
           arrays instead of a wgrid.
   GRID_P scratch_gif3;
   */
-  SWGHT_TYPE swght[SLOPE_WEIGHT_ARRAY_SZ];
+  SWGHT_TYPE *swght;
 
 /** The following three lines were moved from spr_phase5                       **/
-  growth_row = (short *)  mem_GetGRCrowptr();
-  growth_col = (short *)  mem_GetGRCcolptr();
+  growth_offset = mem_GetGRCoffptr();
 /*******************          D.D. Aug. 14, 2006      (End)  ******************/
 
   road_gravity = coeff_GetCurrentRoadGravity ();
@@ -1402,13 +2905,12 @@ void
           arrays instead of a wgrid.
   assert (scratch_gif3 != NULL);
   */
-  total_pixels = mem_GetTotalPixels ();
-  nrows = igrid_GetNumRows ();
   ncols = igrid_GetNumCols ();
 
-  assert (total_pixels > 0);
-  assert (nrows > 0);
+  assert (mem_GetTotalPixels () > 0);
+  assert (igrid_GetNumRows () > 0);
   assert (ncols > 0);
+  wpr = MASK_WORDS_PER_ROW (ncols);
 
 
   /*
@@ -1429,7 +2931,7 @@ void
 
       for (i=0; i<growth_count; i++)
           {
-           delta[OFFSET(growth_row[i], growth_col[i])] = 0;
+           delta[growth_offset[i]] = 0;
           }
 
   growth_count = 0;
@@ -1439,46 +2941,33 @@ void
    * GET SLOPE RATES
    *
    */
-  spr_get_slp_weights (SLOPE_WEIGHT_ARRAY_SZ,                /* IN     */
-                       swght);                               /* OUT    */
-
-/***                          D.D. July 28, 2006               (Begin)       **/
-/***  Call the routine to initialize the array of pointers to road grids.    **/
-
-  spr_rpoList_Init();  /* Only runs on the first call */
-
-/*******************          D.D. July 28, 2006      (End)  ******************/
-
-/***                          D.D. July 28, 2006               (Begin)       **/
-/*** Identify the correct files for road pixels. Create files if necessary.  **/
-  for (rpoIndex=0; rpoIndex<scen_GetRoadDataFileCount(); rpoIndex++)
-     {
-      if (rpoList[rpoIndex] == roads)
-           {
-            if (rpoStatus[rpoIndex] == 1) break;
-            spr_rpoPopulate(rpoIndex);
-            break;
-           }
-     }
-  if (rpoStatus[rpoIndex] != 1) 
-/*******************          D.D. July 28, 2006      (End)  ******************/
-
-/***                          D.D. July 28, 2006               (Begin)       **/
-/*** Set the road-pixel-only row pointers for the current road grid.         **/
-  rporow_ptrNum =  mem_GetRPOrowptrNum(rpoIndex);
-  rporow_ptrMin =  mem_GetRPOrowptrMin(rpoIndex);
-  rporow_ptrMax =  mem_GetRPOrowptrMax(rpoIndex);
-  rporow_ptrIdx =  mem_GetRPOrowptrIdx(rpoIndex);
-  rpocol_ptr    =  mem_GetRPOcolptr(rpoIndex);
-/*******************          D.D. July 28, 2006      (End)  ******************/
+  spr_plan_update ();
+  swght = plan.swght;
+  accept_grid = mem_GetAcceptGridPtr ();
+  if ((accept_grid != NULL) &&
+      (coeff_GetCurrentSlopeResist () != accept_slope_resist))
+  {
+    spr_build_accept_grid (slp,                              /* IN     */
+                           excld,                            /* IN     */
+                           swght);                           /* IN     */
+    accept_slope_resist = coeff_GetCurrentSlopeResist ();
+  }
+
+  spr_road_select (roads);
 
 /*******************          D.D. Aug. 14, 2006      (End)  ******************/
 
 /** D. Donato 8/17/2006 Added to deal with cumulative growth                 **/
-  zgrwth_row = (short *)  mem_GetGRZrowptr();
-  zgrwth_col = (short *)  mem_GetGRZcolptr();
+  zgrwth_offset =         mem_GetGRZoffptr();
   zgrwth_count =          mem_GetGRZcount();
 /** D. Donato 8/17/2006 Added to deal with cumulative growth                 **/
+  nbrcount = mem_GetNbrCountPtr();
+  frontier_offset = mem_GetFRNoffptr();
+  frontier_count = mem_GetFRNcount();
+  elig_cell = mem_GetEligiblePtr();
+  elig_pos = mem_GetEligiblePosPtr();
+  elig_count = mem_GetEligibleCount();
+  zmask = mem_GetZMaskPtr();
 
   /*
    *
@@ -1487,15 +2976,29 @@ void
    */
 
   timer_Start (SPR_PHASE1N3);
-  spr_phase1n3 (diffusion_coefficient,                       /* IN     */
-                breed_coefficient,                           /* IN     */
-                z,                                           /* IN     */
-                delta,                                       /* IN/OUT */
-                slp,                                         /* IN     */
-                excld,                                       /* IN     */
-                swght,                                       /* IN     */
-                sng,                                         /* IN/OUT */
-                sdc);                                        /* IN/OUT */
+  if (scen_GetParallelRandomGrowthFlag ())
+  {
+    spr_phase1n3_trials (diffusion_coefficient,              /* IN     */
+                         breed_coefficient,                  /* IN     */
+                         z,                                  /* IN     */
+                         delta,                              /* IN/OUT */
+                         slp,                                /* IN     */
+                         excld,                              /* IN     */
+                         sng,                                /* IN/OUT */
+                         sdc);                               /* IN/OUT */
+  }
+  else
+  {
+    spr_phase1n3 (diffusion_coefficient,                     /* IN     */
+                  breed_coefficient,                         /* IN     */
+                  z,                                         /* IN     */
+                  delta,                                     /* IN/OUT */
+                  slp,                                       /* IN     */
+                  excld,                                     /* IN     */
+                  swght,                                     /* IN     */
+                  sng,                                       /* IN/OUT */
+                  sdc);                                      /* IN/OUT */
+  }
   timer_Stop (SPR_PHASE1N3); 
 
   /*
@@ -1521,16 +3024,31 @@ void
    */
 
   timer_Start (SPR_PHASE5);
-  spr_phase5 (road_gravity,                                  /* IN     */
-              diffusion_coefficient,                         /* IN     */
-              breed_coefficient,                             /* IN     */
-              z,                                             /* IN     */
-              delta,                                         /* IN/OUT */
-              slp,                                           /* IN     */
-              excld,                                         /* IN     */
-              roads,                                         /* IN     */
-              swght,                                         /* IN     */
-              rt);                                           /* IN/OUT */
+  if (scen_GetParallelRandomGrowthFlag ())
+  {
+    spr_phase5_trials (road_gravity,                         /* IN     */
+                       diffusion_coefficient,                /* IN     */
+                       breed_coefficient,                    /* IN     */
+                       z,                                    /* IN     */
+                       delta,                                /* IN/OUT */
+                       slp,                                  /* IN     */
+                       excld,                                /* IN     */
+                       roads,                                /* IN     */
+                       rt);                                  /* IN/OUT */
+  }
+  else
+  {
+    spr_phase5 (road_gravity,                                /* IN     */
+                diffusion_coefficient,                       /* IN     */
+                breed_coefficient,                           /* IN     */
+                z,                                           /* IN     */
+                delta,                                       /* IN/OUT */
+                slp,                                         /* IN     */
+                excld,                                       /* IN     */
+                roads,                                       /* IN     */
+                swght,                                       /* IN     */
+                rt);                                         /* IN/OUT */
+  }
    /* D.D. Changed July 24, 2006 - No longer passing 
            scratch_gif3. 
               rt,                                            ** IN/OUT **
@@ -1546,12 +3064,6 @@ void
                       delta,                                 ** IN/OUT **
                       0);                                    ** IN     */
 
-      for (i=0; i<growth_count; i++)
-          {
-           if (delta[OFFSET(growth_row[i], growth_col[i])] > PHASE5G)
-              {delta[OFFSET(growth_row[i], growth_col[i])] = 0;}
-          }
-
 /** D.D. 8/18/2006                                                            **/
 
 /** D.D. 8/18/2006 Use the ExcPix  array to condition delta more efficiently. ***
@@ -1563,99 +3075,716 @@ void
                       delta,                                 ** IN/OUT **
                       0);                                    ** IN     */
 
-  ExcPixRow = igrid_GetExcPixRowPtr();
-  ExcPixCol = igrid_GetExcPixColPtr();
+/** D.D. 8/18/2006                                                            **/
+
+/*** D. Donato Aug. 14, 2006 The following loop has been replaced by a  **
+***  more efficient loop. Rather than looping through what is sometimes **
+***  tens of millions of 0 pixels (like the original loop), the new     **
+***  loop only iterates through actual growth pixels.                   **
+  for (i = 0; i < total_pixels; i++)
+  {
+    if ((z[i] == 0) && (delta[i] > 0))
+    {
+      ** new growth being placed into array **
+      (*average_slope) += (float) slp[i];
+      z[i] = delta[i];
+      (*num_growth_pix)++;
+    }
+  }
+***  D. Donato Aug. 14, 2006                                            */
+
+/** D.D. 8/18/2006 Use the zgrwth  arrays to count pixels in z more efficiently. ***
+  *pop = util_count_pixels (total_pixels, z, GE, PHASE0G);
+***                                                                              **/
+
+  /*
+   *
+   * ONE PASS OVER THE GROWTH LIST: delta IS ONLY EVER SET ON THE LIST, SO
+   * CLEARING PHASES ABOVE PHASE5G AND EXCLUDED PIXELS HERE IS THE SAME AS
+   * CONDITIONING THE WHOLE GRID; WHAT IS LEFT IS PLACED INTO z AND ITS
+   * SLOPE AND POSITION ARE SUMMED FOR THE STATISTICS
+   *
+   */
+  (*num_growth_pix) = 0;
+  (*average_slope) = 0.0;
+  zgrwth_first = zgrwth_count;
+  slope_sum = 0.0;
+  xsum = 0.0;
+  ysum = 0.0;
+  for (i=0; i<growth_count; i++)
+  {
+    offset = growth_offset[i];
+    if ((delta[offset] > PHASE5G) || (excld[offset] >= 100))
+    {
+      delta[offset] = 0;
+    }
+    else if ((z[offset] == 0) && (delta[offset] > 0))
+    {
+      /* new growth being placed into array */
+      (*average_slope) += (float) slp[offset];
+      slope_sum += slp[offset];
+      row = offset / ncols;
+      col = offset % ncols;
+      xsum += (double) col;
+      ysum += (double) row;
+      z[offset] = delta[offset];
+      zgrwth_offset[zgrwth_count] = offset;
+      zgrwth_count++;
+      if (nbrcount != NULL) {util_increment_neighbors (nbrcount, row, col);}
+      if (frontier_offset != NULL)
+      {
+        frontier_offset[frontier_count] = offset;
+        frontier_count++;
+      }
+      if (elig_cell != NULL) {spr_eligible_remove (offset);}
+      if (zmask != NULL) {MASK_SET (zmask, wpr, row, col);}
+      (*num_growth_pix)++;
+    }
+  }
+  stats_AddGrowthSums (zgrwth_first,                         /* IN     */
+                       zgrwth_count - zgrwth_first,          /* IN     */
+                       slope_sum,                            /* IN     */
+                       xsum,                                 /* IN     */
+                       ysum);                                /* IN     */
+
+  /* every entry of the cumulative growth list is urban */
+  *pop = zgrwth_count;
+
+  if (*num_growth_pix == 0)
+  {
+    *average_slope = 0.0;
+  }
+  else
+  {
+    *average_slope /= (float) *num_growth_pix;
+  }
+
+/** D. Donato 8/17/2006                                                */
+  mem_SetGRZcount(zgrwth_count);
+/** D. Donato 8/17/2006                                                */
+  mem_SetFRNcount(frontier_count);
+  mem_SetEligibleCount(elig_count);
+
+  roads = igrid_GridRelease (__FILE__, func, __LINE__, roads);
+  excld = igrid_GridRelease (__FILE__, func, __LINE__, excld);
+  slp = igrid_GridRelease (__FILE__, func, __LINE__, slp);
+/** D.D. Following line commented out August 29, 2006                   ***
+  scratch_gif1 = mem_GetWGridFree (__FILE__, func, __LINE__, scratch_gif1);
+*** D.D.              August 29, 2006                                   **/
+/** D.D. Following line commented out July 28, 2006                     ***
+  scratch_gif3 = mem_GetWGridFree (__FILE__, func, __LINE__, scratch_gif3);
+*** D.D.                  July 28, 2006                                 **/
+
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_GetEffectiveCoeff
+** PURPOSE:       find the effective coefficients of a set of coefficients
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Each field is computed as the growth rules compute
+**                it: the truncations of spr_phase1n3 and spr_phase5,
+**                the integer draws the breed and spread tests compare,
+**                spr_GetRoadGravValue, the run lengths of
+**                spr_road_walk and the exponent of
+**                spr_get_slp_weights. Does not push the call stack.
+**
+*/
+void
+  spr_GetEffectiveCoeff (coeff_val_info * coeff,             /* IN     */
+                         spr_effective_t * effective)        /* OUT    */
+{
+  float road_breed;
+  float road_diffusion;
+  float exp;
+  int q;
+
+  assert (coeff != NULL);
+  assert (effective != NULL);
+  effective->draws = 1 + (int) spr_GetDiffusionValue (coeff->diffusion);
+  effective->breed = (int) coeff->breed;
+  effective->spread = 0;
+  while ((effective->spread <= 100) &&
+         (effective->spread < coeff->spread))
+  {
+    effective->spread++;
+  }
+  effective->road_gravity = spr_GetRoadGravValue (coeff->road_gravity);
+
+  if (aux_breed_coeff >= 0)
+  {
+    road_breed = aux_breed_coeff;
+  }
+  else
+  {
+    road_breed = - aux_breed_coeff * coeff->breed;
+  }
+  effective->road_trials = 1 + (int) road_breed;
+
+  if (aux_diffusion_coeff >= 0)
+  {
+    road_diffusion = aux_diffusion_coeff;
+  }
+  else
+  {
+    road_diffusion = - aux_diffusion_coeff * coeff->diffusion;
+  }
+  for (q = 0; q < ROAD_RUN_SIZE; q++)
+  {
+    effective->road_run[q] = (int) (q * (double) road_diffusion);
+  }
+
+  exp = coeff->slope_resistance / (MAX_SLOPE_RESISTANCE_VALUE / 2.0);
+  effective->slope_exp = exp;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_SameEffectiveCoeff
+** PURPOSE:       compare two sets of effective coefficients
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+BOOLEAN
+  spr_SameEffectiveCoeff (spr_effective_t * a,               /* IN     */
+                          spr_effective_t * b)               /* IN     */
+{
+  int q;
+
+  if ((a->draws != b->draws) ||
+      (a->breed != b->breed) ||
+      (a->spread != b->spread) ||
+      (a->road_gravity != b->road_gravity) ||
+      (a->road_trials != b->road_trials) ||
+      (a->slope_exp != b->slope_exp))
+  {
+    return FALSE;
+  }
+  for (q = 0; q < ROAD_RUN_SIZE; q++)
+  {
+    if (a->road_run[q] != b->road_run[q])
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_ReplicaCandidates
+** PURPOSE:       find the pixels that may spread in phase 4, for every
+**                replica at once
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                BIT_SLICED_REPLICAS. Bit k of the scratch word of an
+**                interior pixel is set when the pixel is urban in
+**                replica k and two to seven of its neighbors are (the
+**                test of spr_phase4), found with the same running
+**                ones, twos and eights as util_mask_spreading. The
+**                pixels with any bit set are listed for
+**                spr_SpreadReplica. z does not change until
+**                spr_PlaceReplicas, so this is done once a year.
+**
+*/
+void
+  spr_ReplicaCandidates ()
+{
+  char func[] = "spr_ReplicaCandidates";
+  int walkabout_row[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+  int walkabout_col[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+  int step[8];
+  int k;
+  int n;
+  int offset;
+  int row;
+  int col;
+  int nrows;
+  int ncols;
+  int zcount;
+  int *zlist;
+  int *slist;
+  MASK_WORD *z;
+  MASK_WORD *spread;
+  MASK_WORD ones;
+  MASK_WORD twos;
+  MASK_WORD eights;
+
+  FUNC_INIT;
+  timer_Start (SPR_PHASE4);
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  z = mem_GetReplicaZPtr ();
+  spread = mem_GetReplicaWorkPtr ();
+  zlist = mem_GetReplicaZListPtr ();
+  zcount = mem_GetReplicaZCount ();
+  slist = mem_GetReplicaSpreadListPtr ();
+  assert (z != NULL);
+  assert (spread != NULL);
+
+  for (n = 0; n < 8; n++)
+  {
+    step[n] = walkabout_row[n] * ncols + walkabout_col[n];
+  }
+  rep_spread_count = 0;
+  for (k = 0; k < zcount; k++)
+  {
+    offset = zlist[k];
+    row = offset / ncols;
+    col = offset % ncols;
+    if (row < 1 || row >= nrows - 1) continue;
+    if (col < 1 || col >= ncols - 1) continue;
+    ones = 0;
+    twos = 0;
+    eights = ~(MASK_WORD) 0;
+    for (n = 0; n < 8; n++)
+    {
+      twos |= ones & z[offset + step[n]];
+      ones |= z[offset + step[n]];
+      eights &= z[offset + step[n]];
+    }
+    spread[offset] = z[offset] & twos & ~eights;
+    if (spread[offset] != 0)
+    {
+      slist[rep_spread_count++] = offset;
+    }
+  }
+  timer_Stop (SPR_PHASE4);
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_SpreadReplica
+** PURPOSE:       perform phases 1 to 5 for one replica of a batch
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                BIT_SLICED_REPLICAS. Grows bit lane of the replica
+**                delta grid from bit lane of the replica z grid with
+**                the current coefficients, which are the replica's.
+**                Each draw comes from ran_ReplicaStream or
+**                ran_ReplicaBlock keyed to the replica's own Monte
+**                Carlo iteration: the phase 1 and 3 draws and the
+**                road trips are keyed as PARALLEL_RANDOM_GROWTH keys
+**                its trials, and the phase 4 draws as
+**                PARALLEL_ORGANIC_GROWTH keys its pixels. Attempts
+**                are applied as they are made, as in the serial
+**                phases, and the slope test always uses the slope
+**                thresholds. spr_ReplicaCandidates must have been
+**                called for the year.
+**
+*/
+void
+  spr_SpreadReplica (int lane,                               /* IN     */
+                     int monte_carlo,                        /* IN     */
+                     int *sng,                               /* IN/OUT */
+                     int *sdc,                               /* IN/OUT */
+                     int *og,                                /* IN/OUT */
+                     int *rt)                                /* IN/OUT */
+{
+  char func[] = "spr_SpreadReplica";
+  int walkabout_row[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+  int walkabout_col[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+  unsigned int words[4];
+  ran_stream_t stream;
+  int i;
+  int j;
+  int k;
+  int t;
+  int n;
+  int offset;
+  int target;
+  int ndraws;
+  int ntrials;
+  int tries;
+  int urbanized;
+  int nrows;
+  int ncols;
+  int year;
+  int i_out;
+  int j_out;
+  int i_rd_start;
+  int j_rd_start;
+  int i_rd_end;
+  int j_rd_end;
+  int i_rd_end_nghbr;
+  int j_rd_end_nghbr;
+  int *glist;
+  int *slist;
+  int *llist;
+  COEFF_TYPE breed_coefficient;
+  COEFF_TYPE spread_coefficient;
+  MASK_WORD bit;
+  MASK_WORD *z;
+  MASK_WORD *delta;
+  MASK_WORD *spread;
+  GRID_P excld;
+  GRID_P roads;
+  GRID_P slp;
+
+  excld = igrid_GetExcludedGridPtr (__FILE__, func, __LINE__);
+  roads = igrid_GetRoadGridPtrByYear (__FILE__, func,
+                                      __LINE__, proc_GetCurrentYear ());
+  slp = igrid_GetSlopeGridPtr (__FILE__, func, __LINE__);
+  FUNC_INIT;
+  assert ((lane >= 0) && (lane < REPLICA_LANES));
+  assert (sng != NULL);
+  assert (sdc != NULL);
+  assert (og != NULL);
+  assert (rt != NULL);
+
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  year = proc_GetCurrentYear ();
+  breed_coefficient = coeff_GetCurrentBreed ();
+  spread_coefficient = coeff_GetCurrentSpread ();
+  z = mem_GetReplicaZPtr ();
+  delta = mem_GetReplicaDeltaPtr ();
+  spread = mem_GetReplicaWorkPtr ();
+  glist = mem_GetReplicaGrowthListPtr ();
+  slist = mem_GetReplicaSpreadListPtr ();
+  llist = mem_GetReplicaLaneListPtr ();
+  bit = LANE_BIT (lane);
+
+  spr_plan_update ();
+  spr_road_select (roads);
+
+  /*
+   *
+   * PHASE 1N3 - SPONTANEOUS NEIGHBORHOOD GROWTH AND SPREADING
+   *
+   */
+  timer_Start (SPR_PHASE1N3);
+  ndraws = 1 + (int) plan.diffusion_value;
+  for (k = 0; k < ndraws; k++)
+  {
+    ran_ReplicaStream (&stream, RAN_SUBSTREAM_PHASE1N3, year, k, monte_carlo);
+    i = ran_Bounded (&stream, nrows);
+    j = ran_Bounded (&stream, ncols);
+
+    if (!INTERIOR_PT (i, j)) continue;
+    if (!spr_replica_urbanize (&stream, OFFSET (i, j), bit, z, delta,
+                               slp, excld, sng)) continue;
+    if (ran_Bounded (&stream, 101) >= (int) breed_coefficient) continue;
+
+    urbanized = 0;
+    for (tries = 0; tries < 8; tries++)
+    {
+      if (spr_replica_urbanize_nghbr (&stream, i, j, &i_out, &j_out, bit,
+                                      z, delta, slp, excld, sdc))
+      {
+        urbanized++;
+        if (urbanized == MIN_NGHBR_TO_SPREAD)
+        {
+          break;
+        }
+      }
+    }
+  }
+  timer_Stop (SPR_PHASE1N3);
+
+  /*
+   *
+   * PHASE 4 - ORGANIC GROWTH
+   *
+   */
+  timer_Start (SPR_PHASE4);
+  for (k = 0; k < rep_spread_count; k++)
+  {
+    offset = slist[k];
+    if ((spread[offset] & bit) == 0) continue;
+
+    ran_ReplicaBlock (RAN_SUBSTREAM_PHASE4, year, offset, monte_carlo, words);
+    if (RAN_WORD_BOUNDED (words[0], 101) >= spread_coefficient) continue;
+
+    n = RAN_WORD_BOUNDED (words[1], 8);
+    target = offset + walkabout_row[n] * ncols + walkabout_col[n];
+    if ((z[target] & bit) || (delta[target] & bit)) continue;
+    if ((unsigned long long) words[2] < slope_threshold[slp[target]].words) continue;
+    if (excld[target] >= RAN_WORD_BOUNDED (words[3], 100)) continue;
+    spr_replica_grow (target, bit, delta);
+    (*og)++;
+  }
+  timer_Stop (SPR_PHASE4);
+
+  /*
+   *
+   * PHASE 5 - ROAD INFLUENCE GROWTH, FROM THIS REPLICA'S GROWTH
+   *
+   */
+  timer_Start (SPR_PHASE5);
+  n = 0;
+  for (k = 0; k < rep_growth_count; k++)
+  {
+    if (delta[glist[k]] & bit)
+    {
+      llist[n++] = glist[k];
+    }
+  }
+  if (n > 0)
+  {
+    if (aux_breed_coeff >= 0)
+    {
+      road_growth_breed_coefficient = aux_breed_coeff;
+    }
+    else
+    {
+      road_growth_breed_coefficient = - aux_breed_coeff * breed_coefficient;
+    }
+    if (aux_diffusion_coeff >= 0)
+    {
+      road_growth_diffusion_coefficient = aux_diffusion_coeff;
+    }
+    else
+    {
+      road_growth_diffusion_coefficient =
+        - aux_diffusion_coeff * coeff_GetCurrentDiffusion ();
+    }
+
+    ntrials = 1 + (int) road_growth_breed_coefficient;
+    for (t = 0; t < ntrials; t++)
+    {
+      ran_ReplicaStream (&stream, RAN_SUBSTREAM_PHASE5, year, t, monte_carlo);
+      offset = llist[ran_Bounded (&stream, n)];
+
+      if (!spr_road_nearest (offset / ncols, offset % ncols, plan.road_band,
+                             &i_rd_start, &j_rd_start)) continue;
+      if (!spr_road_walk (i_rd_start, j_rd_start, &i_rd_end, &j_rd_end, roads,
+                          road_growth_diffusion_coefficient, &stream)) continue;
+      if (!spr_replica_urbanize_nghbr (&stream, i_rd_end, j_rd_end,
+                                       &i_rd_end_nghbr, &j_rd_end_nghbr, bit,
+                                       z, delta, slp, excld, rt)) continue;
+      for (tries = 0; tries < 3; tries++)
+      {
+        spr_replica_urbanize_nghbr (&stream, i_rd_end_nghbr, j_rd_end_nghbr,
+                                    &i_out, &j_out, bit,
+                                    z, delta, slp, excld, rt);
+      }
+    }
+  }
+  timer_Stop (SPR_PHASE5);
 
-  colindex=0;
-  for (row=0; row<nrows; row++)
-     {
-      if (ExcPixRow[row] > 0)
-         {
-          for (col=0; col<ExcPixRow[row]; col++)
-              {
-               if (excld[OFFSET(row, ExcPixCol[colindex])] >= 100)
-                   delta[OFFSET(row, ExcPixCol[colindex])] = 0;
-               colindex++;
-              }
-         }
-     }
+  roads = igrid_GridRelease (__FILE__, func, __LINE__, roads);
+  excld = igrid_GridRelease (__FILE__, func, __LINE__, excld);
+  slp = igrid_GridRelease (__FILE__, func, __LINE__, slp);
+  FUNC_END;
+}
 
-/** D.D. 8/18/2006                                                            **/
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_PlaceReplicas
+** PURPOSE:       place the year's growth of every replica into z
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                BIT_SLICED_REPLICAS. The epilogue of spr_spread for a
+**                batch: one pass over the growth list ors delta into
+**                z, lists pixels urban for the first time in any
+**                replica, and counts and sums the new growth of each
+**                replica. delta and the phase 4 scratch are left zero.
+**
+*/
+void
+  spr_PlaceReplicas (int nlanes,                             /* IN     */
+                     int *num_growth_pix,                    /* OUT    */
+                     int *pop,                               /* IN/OUT */
+                     double *slope_sum,                      /* IN/OUT */
+                     double *xsum,                           /* IN/OUT */
+                     double *ysum)                           /* IN/OUT */
+{
+  char func[] = "spr_PlaceReplicas";
+  int k;
+  int lane;
+  int offset;
+  int row;
+  int col;
+  int ncols;
+  int zcount;
+  int *zlist;
+  int *glist;
+  int *slist;
+  MASK_WORD word;
+  MASK_WORD *z;
+  MASK_WORD *delta;
+  MASK_WORD *spread;
+  GRID_P slp;
 
-  /* now place growth array into current array */
-  (*num_growth_pix) = 0;
-  (*average_slope) = 0.0;
+  slp = igrid_GetSlopeGridPtr (__FILE__, func, __LINE__);
+  FUNC_INIT;
+  assert (num_growth_pix != NULL);
+  assert (pop != NULL);
+  ncols = igrid_GetNumCols ();
+  z = mem_GetReplicaZPtr ();
+  delta = mem_GetReplicaDeltaPtr ();
+  spread = mem_GetReplicaWorkPtr ();
+  zlist = mem_GetReplicaZListPtr ();
+  zcount = mem_GetReplicaZCount ();
+  glist = mem_GetReplicaGrowthListPtr ();
+  slist = mem_GetReplicaSpreadListPtr ();
+
+  for (k = 0; k < rep_spread_count; k++)
+  {
+    spread[slist[k]] = 0;
+  }
+  rep_spread_count = 0;
 
-/*** D. Donato Aug. 14, 2006 The following loop has been replaced by a  **
-***  more efficient loop. Rather than looping through what is sometimes **
-***  tens of millions of 0 pixels (like the original loop), the new     **
-***  loop only iterates through actual growth pixels.                   **
-  for (i = 0; i < total_pixels; i++)
+  for (lane = 0; lane < nlanes; lane++)
   {
-    if ((z[i] == 0) && (delta[i] > 0))
+    num_growth_pix[lane] = 0;
+  }
+  for (k = 0; k < rep_growth_count; k++)
+  {
+    offset = glist[k];
+    word = delta[offset] & ~z[offset];
+    delta[offset] = 0;
+    if (z[offset] == 0)
     {
-      ** new growth being placed into array **
-      (*average_slope) += (float) slp[i];
-      z[i] = delta[i];
-      (*num_growth_pix)++;
+      zlist[zcount++] = offset;
+    }
+    z[offset] |= word;
+    row = offset / ncols;
+    col = offset % ncols;
+    for (lane = 0; word != 0; lane++, word >>= 1)
+    {
+      if (word & 1)
+      {
+        num_growth_pix[lane]++;
+        pop[lane]++;
+        slope_sum[lane] += slp[offset];
+        xsum[lane] += (double) col;
+        ysum[lane] += (double) row;
+      }
     }
   }
-***  D. Donato Aug. 14, 2006                                            */
+  rep_growth_count = 0;
+  mem_SetReplicaZCount (zcount);
 
-/**  D. Donato Aug. 14, 2006             New loop   Corrected 8/17/2006 */
-  for (i=0; i<growth_count; i++)
+  slp = igrid_GridRelease (__FILE__, func, __LINE__, slp);
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_replica_grow
+** PURPOSE:       set a replica's bit of a pixel in delta
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   The first replica to grow a pixel in a year puts it on
+**                the growth list.
+**
+**
+*/
+static void
+  spr_replica_grow (int offset,                              /* IN     */
+                    MASK_WORD bit,                           /* IN     */
+                    MASK_WORD * delta)                       /* IN/OUT */
+{
+  if (delta[offset] == 0)
   {
-    if (    (z[OFFSET(growth_row[i], growth_col[i])] == 0) &&
-        (delta[OFFSET(growth_row[i], growth_col[i])]  > 0)   )
-     {
-      /* new growth being placed into array */
-      (*average_slope) += (float) slp[OFFSET(growth_row[i], growth_col[i])];
-          z[OFFSET(growth_row[i], growth_col[i])] =
-      delta[OFFSET(growth_row[i], growth_col[i])];
-         zgrwth_row[zgrwth_count] = growth_row[i];
-         zgrwth_col[zgrwth_count] = growth_col[i];
-         zgrwth_count++;
-      (*num_growth_pix)++;
-     }
+    mem_GetReplicaGrowthListPtr ()[rep_growth_count++] = offset;
   }
-/** D. Donato Aug. 14, 2006          End of New Loop                    */
-
-/** D.D. 8/18/2006 Use the zgrwth  arrays to count pixels in z more efficiently. ***
-  *pop = util_count_pixels (total_pixels, z, GE, PHASE0G);
-***                                                                              **/
+  delta[offset] |= bit;
+}
 
-  *pop = 0;
-  for (i=0; i<zgrwth_count; i++)
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_replica_urbanize
+** PURPOSE:       try to urbanize a pixel in one replica
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                spr_urbanize on the replica's bit: the same tests and
+**                draws, from the given stream. Does not push the call
+**                stack.
+**
+*/
+static BOOLEAN
+  spr_replica_urbanize (ran_stream_t * stream,               /* IN/OUT */
+                        int offset,                          /* IN     */
+                        MASK_WORD bit,                       /* IN     */
+                        MASK_WORD * z,                       /* IN     */
+                        MASK_WORD * delta,                   /* IN/OUT */
+                        GRID_P slp,                          /* IN     */
+                        GRID_P excld,                        /* IN     */
+                        int *stat)                           /* IN/OUT */
+{
+  if ((z[offset] & bit) || (delta[offset] & bit))
   {
-   if (z[OFFSET(zgrwth_row[i], zgrwth_col[i])] >= PHASE0G) {*pop++;}
+    return FALSE;
   }
-
-/** D.D. 8/18/2006 Use the zgrwth  arrays to count pixels in z more efficiently. **/
-
-  if (*num_growth_pix == 0)
+  if (!ran_Exceeds (stream, &slope_threshold[slp[offset]]))
   {
-    *average_slope = 0.0;
+    return FALSE;
   }
-  else
+  if (excld[offset] >= ran_Bounded (stream, 100))
   {
-    *average_slope /= (float) *num_growth_pix;
+    return FALSE;
   }
+  spr_replica_grow (offset, bit, delta);
+  (*stat)++;
+  return TRUE;
+}
 
-/** D. Donato 8/17/2006                                                */
-  mem_SetGRZcount(zgrwth_count);
-/** D. Donato 8/17/2006                                                */
-
-  roads = igrid_GridRelease (__FILE__, func, __LINE__, roads);
-  excld = igrid_GridRelease (__FILE__, func, __LINE__, excld);
-  slp = igrid_GridRelease (__FILE__, func, __LINE__, slp);
-/** D.D. Following line commented out August 29, 2006                   ***
-  scratch_gif1 = mem_GetWGridFree (__FILE__, func, __LINE__, scratch_gif1);
-*** D.D.              August 29, 2006                                   **/
-/** D.D. Following line commented out July 28, 2006                     ***
-  scratch_gif3 = mem_GetWGridFree (__FILE__, func, __LINE__, scratch_gif3);
-*** D.D.                  July 28, 2006                                 **/
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_replica_urbanize_nghbr
+** PURPOSE:       try to urbanize a neighbor in one replica
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Picks the neighbor as spr_trial_urbanize_nghbr does.
+**
+**
+*/
+static BOOLEAN
+  spr_replica_urbanize_nghbr (ran_stream_t * stream,         /* IN/OUT */
+                              int i,                         /* IN     */
+                              int j,                         /* IN     */
+                              int *i_nghbr,                  /* OUT    */
+                              int *j_nghbr,                  /* OUT    */
+                              MASK_WORD bit,                 /* IN     */
+                              MASK_WORD * z,                 /* IN     */
+                              MASK_WORD * delta,             /* IN/OUT */
+                              GRID_P slp,                    /* IN     */
+                              GRID_P excld,                  /* IN     */
+                              int *stat)                     /* IN/OUT */
+{
+  int k;
+  int n;
 
-  FUNC_END;
+  if (!IMAGE_PT (i, j))
+  {
+    return FALSE;
+  }
+  k = ran_Bounded (stream, 8);
+  for (n = 0; n < 8; n++)
+  {
+    (*i_nghbr) = i + ring_row[k];
+    (*j_nghbr) = j + ring_col[k];
+    if (IMAGE_PT ((*i_nghbr), (*j_nghbr)))
+    {
+      break;
+    }
+    k = (k + 1) % 8;
+  }
+  return spr_replica_urbanize (stream, OFFSET ((*i_nghbr), (*j_nghbr)), bit,
+                               z, delta, slp, excld, stat);
 }
 
 /******************************************************************************
@@ -1679,10 +3808,29 @@ static void
 
   char func[]="spr_rpoList_Init";
   int i;
-  FILE *DD01DBG;
+  int k;
+  int mask;
 
   if (rpoInitIndic == 'Y') {return;} /* Not necessary to reinitialize */
 
+  /* Direction a road walk takes from a node with neighbor mask "mask" */
+  /* when util_get_next_neighbor starts at direction k.                */
+  for (k=0; k<8; k++)
+       {
+        for (mask=0; mask<256; mask++)
+             {
+              walk_turn[k][mask] = -1;
+              for (i=0; i<8; i++)
+                   {
+                    if (mask & (1 << ((k + i) % 8)))
+                         {
+                          walk_turn[k][mask] = (k + i) % 8;
+                          break;
+                         }
+                   }
+             }
+       }
+
   mem_AllocateRPOcol(); /* Allocate memory for RPO column arrays. */
 
   for (i=0; i<scen_GetRoadDataFileCount();i++)
@@ -1710,9 +3858,7 @@ static void
 static void
    spr_rpoPopulate(int i)
 {  
-  char func[] = "spr_rpoPopulate";
-  int row, col, rowmax, colmax, numpixels, mincol, maxcol, index;
-  FILE *DD01DBG;
+  int row, col, rowmax, colmax, mincol, maxcol, index;
 
   index = 0;
   rowmax = igrid_GetNumRows();
@@ -1741,11 +3887,443 @@ static void
         rporow_ptrMin[row]=mincol;
         rporow_ptrMax[row]=maxcol;
        }
+  spr_rpoGraph(i);
   rpoStatus[i] = 1;
 
   return;
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_rpoNearest()
+** PURPOSE:       build the nearest-road index for a road grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   For every pixel, finds the linear offset of the road
+**                pixel the band search in spr_road_search settles on
+**                (-1 if it finds none at any radius), so a search
+**                becomes a lookup and a Chebyshev distance test
+**                against bn. The answers are swept into a scratch grid
+**                and kept as runs along each row, so a road grid holds
+**                a few entries per road pixel rather than one per
+**                pixel; a lookup is a binary search of the row's runs.
+**
+**                The band search takes, in each row, the column its
+**                binary search lands on, and keeps the row with the
+**                smallest  max (row distance, column distance),
+**                preferring the nearer row, then the row above. A
+**                distance of zero is never taken. The index is built
+**                for the row counts in rporow_ptrNum, which need not
+**                be this grid's own (see spr_spread), so the binary
+**                search is replayed on each row's list as is.
+**
+**                Each column is swept down and up; a row is dropped
+**                from the sweep once a nearer row lands at least as
+**                close in column, which leaves the rows in order of
+**                column distance, and the best row above (below) is
+**                one of the two either side of the point where row
+**                distance stops dominating.
+**
+**                A row is only searched when its road pixels overlap
+**                the band, which cannot matter when the column landed
+**                on lies inside the row's road span. When it does not
+**                (row counts from another grid) the row is only
+**                searched from the radius that reaches its span. If
+**                that radius is above the row's own distance and the
+**                row would beat the answer, the pixel gets a candidate
+**                list instead: its run value is -2 - start, and from
+**                start the list holds (offset, radius) pairs in the
+**                band search's order of preference, ending with the
+**                answer and radius 0. spr_road_nearest takes the first
+**                pair whose radius the band reaches.
+*/
+static void
+   spr_rpoNearest(int i)
+{
+  char func[] = "spr_rpoNearest";
+  int row, col, k, j, n, nrows, ncols, top, lo, hi, mid, nanom;
+  int best, bval, bdist, val, dist, span, ncand, m, prev;
+  int list_count, list_size;
+  int *rmin, *rmax, *rcol;
+  int *ridx, *near, *nidx, *ncol, *nval;
+  int *hcol, *dcol, *stack, *up, *anom, *cand, *list;
+
+  nrows = igrid_GetNumRows();
+  ncols = igrid_GetNumCols();
+  rmin  = mem_GetRPOrowptrMin (i);
+  rmax  = mem_GetRPOrowptrMax (i);
+  ridx  = mem_GetRPOrowptrIdx (i);
+  rcol  = mem_GetRPOcolptr (i);
+  nidx  = mem_GetRPOnearIdxptr (i);
+
+  near  = malloc (mem_GetTotalPixels () * sizeof (int));
+  if (near == NULL)
+  {
+    sprintf (msg_buf, "Unable to allocate %lu bytes of memory (RPO nearest)",
+             (unsigned long) mem_GetTotalPixels () * sizeof (int));
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  hcol  = malloc (nrows * sizeof (int));
+  dcol  = malloc (nrows * sizeof (int));
+  stack = malloc (nrows * sizeof (int));
+  up    = malloc (nrows * sizeof (int));
+  anom  = malloc (nrows * sizeof (int));
+  cand  = malloc (nrows * sizeof (int));
+  if (hcol == NULL || dcol == NULL || stack == NULL || up == NULL ||
+      anom == NULL || cand == NULL)
+  {
+    sprintf (msg_buf, "Unable to allocate %lu bytes of memory (RPO nearest)",
+             (unsigned long) (6 * nrows * sizeof (int)));
+    LOG_ERROR (msg_buf);
+    EXIT (1);
+  }
+  list = NULL;
+  list_count = 0;
+  list_size = 0;
+
+  /** Column the band search lands on in each row, or -1 if the row  **/
+  /** is never searched.                                              **/
+  for (row=0; row < nrows; row++)
+       {
+        n = rporow_ptrNum[row];
+        for (col=0; col < ncols; col++)
+             {
+              if (n == 0 || rmin[row] >= ncols) {near[OFFSET(row,col)] = -1; continue;}
+              lo = 0; hi = n - 1;
+              while ((hi - lo) > 1)
+                   {
+                    mid = (hi + lo)/2;
+                    if (rcol[ridx[row]+mid] <= col) {lo = mid;}
+                    else                            {hi = mid;}
+                   }
+              if ( (rcol[ridx[row]+hi] - col) < (col - rcol[ridx[row]+lo]) )
+                   {k = hi;} else {k = lo;}
+              near[OFFSET(row,col)] = rcol[ridx[row]+k];
+             }
+       }
+
+  for (col=0; col < ncols; col++)
+       {
+        nanom = 0;
+        for (row=0; row < nrows; row++)
+             {
+              hcol[row] = near[OFFSET(row,col)];
+              dcol[row] = (hcol[row] < 0) ? -1 : abs (hcol[row] - col);
+              if (dcol[row] < 0) {continue;}
+              span = MAX (0, MAX (rmin[row] - col, col - rmax[row]));
+              if (span > dcol[row])
+                   {
+                    anom[nanom++] = row;
+                    dcol[row] = -1;
+                   }
+             }
+
+        /** Sweep down: best row above each row. **/
+        top = 0;
+        for (row=0; row < nrows; row++)
+             {
+              up[row] = -1;
+              if (top > 0)
+                   {
+                    /* first stack entry where column distance dominates */
+                    lo = 0; hi = top;
+                    while (lo < hi)
+                         {
+                          mid = (lo + hi) / 2;
+                          if (stack[mid] + dcol[stack[mid]] > row) {hi = mid;}
+                          else                                     {lo = mid + 1;}
+                         }
+                    if (lo > 0) {up[row] = stack[lo-1];}
+                    if (lo < top)
+                         {
+                          k = stack[lo];
+                          if (up[row] < 0 || dcol[k] <= row - up[row]) {up[row] = k;}
+                         }
+                   }
+              if (dcol[row] >= 0)
+                   {
+                    while (top > 0 && dcol[stack[top-1]] >= dcol[row]) {top--;}
+                    stack[top++] = row;
+                   }
+             }
+
+        /** Sweep up: best row below each row, then pick the winner. **/
+        top = 0;
+        for (row=nrows-1; row >= 0; row--)
+             {
+              best = -1; bval = 0; bdist = 0;
+              if (dcol[row] > 0)
+                   {best = row; bval = dcol[row]; bdist = 0;}
+              if (up[row] >= 0)
+                   {
+                    dist = row - up[row];
+                    val = MAX (dist, dcol[up[row]]);
+                    if (best < 0 || val < bval)
+                         {best = up[row]; bval = val; bdist = dist;}
+                   }
+              if (top > 0)
+                   {
+                    lo = 0; hi = top;
+                    while (lo < hi)
+                         {
+                          mid = (lo + hi) / 2;
+                          if (stack[mid] - dcol[stack[mid]] < row) {hi = mid;}
+                          else                                     {lo = mid + 1;}
+                         }
+                    for (j = lo - 1; j <= lo; j++)
+                         {
+                          if (j < 0 || j >= top) {continue;}
+                          k = stack[j];
+                          dist = k - row;
+                          val = MAX (dist, dcol[k]);
+                          if (best < 0 || val < bval || (val == bval && dist < bdist))
+                               {best = k; bval = val; bdist = dist;}
+                         }
+                   }
+              /** Rows searched whenever they could win join the answer; **/
+              /** the others that would beat it become candidates.        **/
+              ncand = 0;
+              for (j = 0; j < nanom; j++)
+                   {
+                    k = anom[j];
+                    dist = abs (k - row);
+                    val = MAX (dist, abs (hcol[k] - col));
+                    span = MAX (0, MAX (rmin[k] - col, col - rmax[k]));
+                    if (val == 0) {continue;}
+                    if (MAX (dist, span) > val) {cand[ncand++] = k; continue;}
+                    if (best < 0 || SPR_NEAR_BEFORE (val, dist, k, bval, bdist, best))
+                         {best = k; bval = val; bdist = dist;}
+                   }
+              m = 0;
+              for (j = 0; j < ncand; j++)
+                   {
+                    k = cand[j];
+                    dist = abs (k - row);
+                    val = MAX (dist, abs (hcol[k] - col));
+                    if (best >= 0 && !SPR_NEAR_BEFORE (val, dist, k, bval, bdist, best))
+                         {continue;}
+                    /* insert in order of preference */
+                    for (n = m; n > 0; n--)
+                         {
+                          prev = cand[n-1];
+                          if (!SPR_NEAR_BEFORE (val, dist, k,
+                                                MAX (abs (prev - row), abs (hcol[prev] - col)),
+                                                abs (prev - row), prev)) {break;}
+                          cand[n] = prev;
+                         }
+                    cand[n] = k;
+                    m++;
+                   }
+              near[OFFSET(row,col)] = (best < 0) ? -1 : OFFSET(best, hcol[best]);
+              if (m > 0)
+                   {
+                    if (list_count + 2 * (m + 1) > list_size)
+                         {
+                          list_size = 2 * list_size + 2 * (m + 1);
+                          list = realloc (list, list_size * sizeof (int));
+                          if (list == NULL)
+                               {
+                                sprintf (msg_buf, "Unable to allocate %lu bytes of memory (RPO nearest)",
+                                         (unsigned long) (list_size * sizeof (int)));
+                                LOG_ERROR (msg_buf);
+                                EXIT (1);
+                               }
+                         }
+                    n = list_count;
+                    for (j = 0; j < m; j++)
+                         {
+                          k = cand[j];
+                          span = MAX (0, MAX (rmin[k] - col, col - rmax[k]));
+                          list[list_count++] = OFFSET(k, hcol[k]);
+                          list[list_count++] = MAX (abs (k - row), span);
+                         }
+                    list[list_count++] = near[OFFSET(row,col)];
+                    list[list_count++] = 0;
+                    near[OFFSET(row,col)] = -2 - n;
+                   }
+              if (dcol[row] >= 0)
+                   {
+                    while (top > 0 && dcol[stack[top-1]] >= dcol[row]) {top--;}
+                    stack[top++] = row;
+                   }
+             }
+       }
+
+  free (hcol);
+  free (dcol);
+  free (stack);
+  free (up);
+  free (anom);
+  free (cand);
+
+  /** Keep one run per change of answer along each row. **/
+  n = 0;
+  for (row=0; row < nrows; row++)
+       {
+        nidx[row] = n;
+        for (col=0; col < ncols; col++)
+             {
+              if (col == 0 ||
+                  !spr_rpoNearSame (near[OFFSET(row,col)], near[OFFSET(row,col-1)], list))
+                   {n++;}
+             }
+       }
+  nidx[nrows] = n;
+  mem_AllocateRPOnear (i, n, list_count);
+  ncol = mem_GetRPOnearColptr (i);
+  nval = mem_GetRPOnearptr (i);
+  n = 0;
+  for (row=0; row < nrows; row++)
+       {
+        for (col=0; col < ncols; col++)
+             {
+              if (col == 0 ||
+                  !spr_rpoNearSame (near[OFFSET(row,col)], near[OFFSET(row,col-1)], list))
+                   {
+                    ncol[n] = col;
+                    nval[n] = near[OFFSET(row,col)];
+                    n++;
+                   }
+             }
+       }
+  if (list_count > 0)
+       {
+        memcpy (mem_GetRPOnearListptr (i), list, list_count * sizeof (int));
+       }
+  free (list);
+  free (near);
+
+  rponearNum[i] = rporow_ptrNum;
+
+  return;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_rpoNearSame()
+** PURPOSE:       compare two nearest-road answers
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   TRUE if the two run values of spr_rpoNearest give the
+**                same road pixel at every radius: equal offsets, or
+**                candidate lists in list with the same pairs.
+**
+*/
+static BOOLEAN
+   spr_rpoNearSame(int a, int b, int *list)
+{
+  if (a == b) return TRUE;
+  if (a > -2 || b > -2) return FALSE;
+  a = -(a + 2);
+  b = -(b + 2);
+  while (list[a] == list[b] && list[a + 1] == list[b + 1])
+       {
+        if (list[a + 1] == 0) return TRUE;
+        a += 2;
+        b += 2;
+       }
+  return FALSE;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_rpoNode()
+** PURPOSE:       find the road-graph node of a pixel
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Returns the node (RPO column-array index) of pixel
+**                (row,col) in road grid i, or -1 if it is not a road
+**                pixel. Uses the grid's own RPO row arrays.
+**
+*/
+static int
+   spr_rpoNode(int i, int row, int col)
+{
+  int lo, hi, mid;
+  int *rnum;
+  int *rcol;
+  int *ridx;
+
+  rnum = mem_GetRPOrowptrNum (i);
+  ridx = mem_GetRPOrowptrIdx (i);
+  rcol = mem_GetRPOcolptr (i);
+
+  lo = ridx[row]; hi = ridx[row] + rnum[row] - 1;
+  while (lo <= hi)
+       {
+        mid = (lo + hi) / 2;
+        if      (rcol[mid] < col) {lo = mid + 1;}
+        else if (rcol[mid] > col) {hi = mid - 1;}
+        else                      {return mid;}
+       }
+  return -1;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: spr_rpoGraph()
+** PURPOSE:       compile a road grid into a road graph
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   One node per road pixel, numbered as in the RPO column
+**                array, holding its linear offset, its road value, a
+**                mask of the neighbors that are road pixels inside the
+**                image, and the node of each such neighbor. spr_road_walk
+**                walks the graph instead of the dense road grid.
+**
+*/
+static void
+   spr_rpoGraph(int i)
+{
+  int row, col, node, k, nrow, ncol, nrows, ncols, count;
+  int *rnum;
+  int *rcol;
+  int *ridx;
+  int *noff;
+  int *nnbr;
+  unsigned char *nmask;
+  PIXEL *nval;
+
+  nrows = igrid_GetNumRows();
+  ncols = igrid_GetNumCols();
+  rnum  = mem_GetRPOrowptrNum (i);
+  ridx  = mem_GetRPOrowptrIdx (i);
+  rcol  = mem_GetRPOcolptr (i);
+  noff  = mem_GetRPOnodeOffptr (i);
+  nnbr  = mem_GetRPOnodeNbrptr (i);
+  nmask = mem_GetRPOnodeMaskptr (i);
+  nval  = mem_GetRPOnodeValptr (i);
+
+  for (row=0; row < nrows; row++)
+       {
+        count = rnum[row];
+        for (node=ridx[row]; node < ridx[row] + count; node++)
+             {
+              col = rcol[node];
+              noff[node]  = row * ncols + col;
+              nval[node]  = rpoList[i][noff[node]];
+              nmask[node] = 0;
+              for (k=0; k<8; k++)
+                   {
+                    nrow = row + ring_row[k];
+                    ncol = col + ring_col[k];
+                    nnbr[8*node+k] = -1;
+                    if (!IMAGE_PT (nrow, ncol)) {continue;}
+                    if (rpoList[i][OFFSET(nrow,ncol)] == 0) {continue;}
+                    nnbr[8*node+k] = spr_rpoNode (i, nrow, ncol);
+                    nmask[node] |= (1 << k);
+                   }
+             }
+       }
+
+  return;
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: max
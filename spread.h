@@ -15,6 +15,7 @@
 
 #ifndef SPREAD_H
 #define SPREAD_H
+#include "coeff_obj.h"
 
 #ifdef SPREAD_MODULE
   /* stuff visable only to the growth module */
@@ -26,6 +27,43 @@ char spread_h_sccs_id[] = "@(#)spread.h	1.243	12/4/00";
 
 /* #defines visable to any module including this header file*/
 
+/*
+ *
+ * ORGANIC_FRONTIER SETTINGS (phase 4)
+ *
+ * ORGANIC_FRONTIER_OFF    - visit every urban pixel, as always
+ * ORGANIC_FRONTIER_ON     - visit only urban pixels with a non-urban
+ *                           neighbor; surrounded pixels no longer
+ *                           draw a random number, so results differ
+ * ORGANIC_FRONTIER_LEGACY - visit every urban pixel in the usual order
+ *                           but skip all work but the random draw for
+ *                           surrounded ones; results are unchanged
+ *
+ */
+#define ORGANIC_FRONTIER_OFF    0
+#define ORGANIC_FRONTIER_ON     1
+#define ORGANIC_FRONTIER_LEGACY 2
+
+/*
+ *
+ * EFFECTIVE COEFFICIENTS: what the growth rules use of a set of
+ * coefficients. Two sets with equal effective coefficients grow the
+ * same from the same random numbers.
+ *
+ */
+#define ROAD_RUN_SIZE ((255 / MAX_ROAD_VALUE) + 1)
+typedef struct
+{
+  int draws;                     /* phase 1 and 3 draws                */
+  int breed;                     /* phase 1 and 3 breed test           */
+  int spread;                    /* draws of 0 to 100 below spread     */
+  int road_gravity;              /* spr_GetRoadGravValue               */
+  int road_trials;               /* phase 5 trials                     */
+  int road_run[ROAD_RUN_SIZE];   /* spr_road_walk run length, by road  */
+                                 /* value / MAX_ROAD_VALUE             */
+  float slope_exp;               /* exponent of the slope weights      */
+} spr_effective_t;
+
 /*
  *
  * FUNCTION PROTOTYPES
@@ -45,4 +83,38 @@ void
               GRID_P z                                     /* IN/OUT */
               );                       /* MOD    */
 
+void
+  spr_InitEligibleCells (GRID_P z);                          /* IN     */
+
+void
+  spr_GetEffectiveCoeff (coeff_val_info * coeff,             /* IN     */
+                         spr_effective_t * effective);       /* OUT    */
+
+BOOLEAN
+  spr_SameEffectiveCoeff (spr_effective_t * a,               /* IN     */
+                          spr_effective_t * b);              /* IN     */
+
+BOOLEAN
+  spr_SettleRoads (int first_year,                           /* IN     */
+                   int last_year);                           /* IN     */
+
+void
+  spr_ReplicaCandidates ();
+
+void
+  spr_SpreadReplica (int lane,                               /* IN     */
+                     int monte_carlo,                        /* IN     */
+                     int *sng,                               /* IN/OUT */
+                     int *sdc,                               /* IN/OUT */
+                     int *og,                                /* IN/OUT */
+                     int *rt);                               /* IN/OUT */
+
+void
+  spr_PlaceReplicas (int nlanes,                             /* IN     */
+                     int *num_growth_pix,                    /* OUT    */
+                     int *pop,                               /* IN/OUT */
+                     double *slope_sum,                      /* IN/OUT */
+                     double *xsum,                           /* IN/OUT */
+                     double *ysum);                          /* IN/OUT */
+
 #endif
@@ -31,6 +31,9 @@
 #include <stdio.h>
 #include <errno.h>
 #include <math.h>
+#ifdef _OPENMP
+#include <sched.h>
+#endif
 #include "ugm_defines.h"
 #include "pgrid_obj.h"
 #include "proc_obj.h"
@@ -71,6 +74,11 @@ char stats_obj_c_sccs_id[] = "@(#)stats_obj.c	1.72	12/4/00";
 #define MAX_LINE_LEN 256
 #define SIZE_CIR_Q 6000   /*VerD*/
 
+/* PIPELINED_STATS hand-off states */
+#define PIPELINE_IDLE   0
+#define PIPELINE_POSTED 1
+#define PIPELINE_STOP   2
+
 #define Q_STORE(R,C)                                                     \
   if((sidx+1==ridx)||((sidx+1==SIZE_CIR_Q)&&!ridx)){                     \
     printf("Error Circular Queue Full\n");                               \
@@ -128,14 +136,15 @@ static stats_info regression;
 static stats_val_t average[MAX_URBAN_YEARS];
 static stats_val_t std_dev[MAX_URBAN_YEARS];
 static stats_val_t running_total[MAX_URBAN_YEARS];
-static struct
+typedef struct
 {
   int run;
   int monte_carlo;
   int year;
   stats_val_t this_year;
 }
-record;
+stats_record_t;
+static stats_record_t record;
 
 static struct
 {
@@ -148,6 +157,9 @@ static struct
 }
 aggregate;
 
+/* what the last stats_Analysis wrote to control_stats.log */
+static stats_control_t last_control;
+
 static struct
 {
   long successes;
@@ -155,9 +167,22 @@ static struct
   long delta_failure;
   long slope_failure;
   long excluded_failure;
+  long skipped_draws;
 }
 urbanization_attempt;
 
+/* sums over the first "summed" entries of the cumulative growth list, */
+/* kept up to date by spr_spread so stats_circle need not revisit them */
+static struct
+{
+  int summed;
+  int number;
+  double slope;
+  double xsum;
+  double ysum;
+}
+growth_sums;
+
 static int sidx;
 static int ridx;
 
@@ -172,11 +197,57 @@ ugm_link;
 static struct ugm_link cir_q[SIZE_CIR_Q];
 
 /** D. Donato 8/21/2006 Added to deal with cumulative growth                 **/
-  short *zgrwth_row;
-  short *zgrwth_col;
+  int   *zgrwth_offset;
   int    zgrwth_count;
 /** D. Donato 8/21/2006 Added to deal with cumulative growth                 **/
 
+/* grow_*.log records and xypoints lines stats_DeferOutput holds back */
+typedef struct
+{
+  char filename[MAX_FILENAME_LEN];
+  stats_record_t record;
+}
+stats_deferred_t;
+static stats_deferred_t *deferred_records;
+static int deferred_count;
+static int deferred_size;
+static FILE *deferred_xypoints;
+static BOOLEAN deferring_output;
+
+/* the grid whose growth list is zgrwth_offset, and its bit mask; the */
+/* edge, cluster and circle loops use the list when Z is this grid    */
+static GRID_P grz_z;
+static MASK_WORD *grz_mask;
+
+/* which urban input grids are packed in their URBAN_BIT_MASKS mask; */
+/* cleared by stats_ClearUrbanMasks when the grids are read          */
+static BOOLEAN urban_mask_built[MAX_URBAN_YEARS];
+
+/* PIPELINED_STATS: the record of a year waiting for its edge and     */
+/* cluster statistics, the copy of Z (with its growth list and mask)  */
+/* the helper thread computes them from, and the helper's scratch     */
+static BOOLEAN pipeline_active;
+static int pipeline_state;
+static BOOLEAN pipeline_pending;
+static BOOLEAN pipeline_urban_year;
+static stats_record_t pipeline_record;
+static GRID_P pipeline_z;
+static GRID_P pipeline_grz_z;
+static int *pipeline_offset;
+static int pipeline_count;
+static MASK_WORD *pipeline_mask;
+static MASK_WORD *pipeline_grz_mask;
+static GRID_P pipeline_scratch1;
+static GRID_P pipeline_scratch2;
+
+#ifdef _OPENMP
+#pragma omp threadprivate (record, urbanization_attempt, growth_sums)
+#pragma omp threadprivate (sidx, ridx, cir_q, zgrwth_offset, zgrwth_count)
+#pragma omp threadprivate (deferred_records, deferred_count, deferred_size)
+#pragma omp threadprivate (deferred_xypoints, deferring_output)
+#pragma omp threadprivate (grz_z, grz_mask)
+#endif
+
 /*****************************************************************************\
 *******************************************************************************
 **                                                                           **
@@ -185,6 +256,7 @@ static struct ugm_link cir_q[SIZE_CIR_Q];
 *******************************************************************************
 \*****************************************************************************/
 static void stats_Save (char *filename);
+static void stats_write_record (char *filename);
 static void stats_LogThisYearStats (FILE * fp);
 static void stats_CalGrowthRate ();
 static void stats_CalPercentUrban (int, int, int);
@@ -199,6 +271,19 @@ static void stats_LogStatVal (int run, int year, int index,
                               stats_val_t * stats_ptr, FILE * fp);
 static void stats_LogStatValHdr (FILE * fp);
 static void stats_ComputeThisYearStats ();
+static void stats_update_record (int num_growth_pix,          /* IN     */
+                                 BOOLEAN compute_leesalee);  /* IN     */
+static BOOLEAN stats_measure_record (int num_growth_pix,     /* IN     */
+                                     BOOLEAN compute_leesalee); /* IN  */
+static void stats_save_record (BOOLEAN urban_year);          /* IN     */
+static void stats_use_grz (GRID_P z,                         /* IN     */
+                           int *offset,                      /* IN     */
+                           int count,                        /* IN     */
+                           MASK_WORD * mask);                /* IN     */
+static int stats_urban_count (GRID_P z);                     /* IN     */
+static void stats_update_pipelined (int num_growth_pix);     /* IN     */
+static void stats_wait_pipeline ();
+static void stats_save_pending ();
 static void stats_SetNumGrowthPixels (int val);
 static void stats_CalLeesalee ();
 static void stats_ProcessGrowLog (int run, int year);
@@ -542,8 +627,86 @@ void
 void
   stats_Update (int num_growth_pix)
 {
-  char func[] = "stats_Update";
-  char filename[MAX_FILENAME_LEN];
+  if (pipeline_active)
+  {
+    stats_update_pipelined (num_growth_pix);
+    return;
+  }
+  stats_ComputeThisYearStats ();
+  stats_update_record (num_growth_pix, TRUE);
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_UpdateReplica
+** PURPOSE:       stats_Update for one replica of a BIT_SLICED_REPLICAS
+**                batch
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The replica's statistics come from the batch (see
+**                stats_ComputeReplicaStats) rather than from the Z
+**                grid; the rest is stats_Update.
+**
+*/
+void
+  stats_UpdateReplica (int num_growth_pix,                   /* IN     */
+                       stats_val_t * values)                 /* IN     */
+{
+  assert (values != NULL);
+  record.this_year.area = values->area;
+  record.this_year.edges = values->edges;
+  record.this_year.clusters = values->clusters;
+  record.this_year.pop = values->pop;
+  record.this_year.xmean = values->xmean;
+  record.this_year.ymean = values->ymean;
+  record.this_year.slope = values->slope;
+  record.this_year.rad = values->rad;
+  record.this_year.mean_cluster_size = values->mean_cluster_size;
+  record.this_year.leesalee = values->leesalee;
+  record.this_year.diffusion = coeff_GetCurrentDiffusion ();
+  record.this_year.spread = coeff_GetCurrentSpread ();
+  record.this_year.breed = coeff_GetCurrentBreed ();
+  record.this_year.slope_resistance = coeff_GetCurrentSlopeResist ();
+  record.this_year.road_gravity = coeff_GetCurrentRoadGravity ();
+  stats_update_record (num_growth_pix, FALSE);
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_update_record
+** PURPOSE:       finish and save this year's record
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                The tail of stats_Update, shared with
+**                stats_UpdateReplica, which has its Lee-Salee already.
+**
+*/
+static void
+  stats_update_record (int num_growth_pix,                   /* IN     */
+                       BOOLEAN compute_leesalee)             /* IN     */
+{
+  stats_save_record (stats_measure_record (num_growth_pix,
+                                           compute_leesalee));
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_measure_record
+** PURPOSE:       finish this year's record
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                The first half of stats_update_record: the growth
+**                rate, percent urban and, in an urban year, the
+**                Lee-Salee. Returns TRUE if this is an urban year.
+**
+*/
+static BOOLEAN
+  stats_measure_record (int num_growth_pix,                  /* IN     */
+                        BOOLEAN compute_leesalee)            /* IN     */
+{
   int total_pixels;
   int road_pixel_count;
   int excluded_pixel_count;
@@ -552,33 +715,64 @@ void
   road_pixel_count = igrid_GetIGridRoadPixelCount (proc_GetCurrentYear ());
   excluded_pixel_count = igrid_GetIGridExcludedPixelCount ();
 
-  stats_ComputeThisYearStats ();
+  record.run = proc_GetCurrentRun ();
+  record.monte_carlo = proc_GetCurrentMonteCarlo ();
+  record.year = proc_GetCurrentYear ();
+
   stats_SetNumGrowthPixels (num_growth_pix);
   stats_CalGrowthRate ();
   stats_CalPercentUrban (total_pixels, road_pixel_count, excluded_pixel_count);
 
   if (igrid_TestForUrbanYear (proc_GetCurrentYear ()))
   {
-    stats_CalLeesalee ();
+    if (compute_leesalee)
+    {
+      stats_CalLeesalee ();
+    }
+    return TRUE;
+  }
+  return FALSE;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_save_record
+** PURPOSE:       save the record
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                The second half of stats_update_record. Everything
+**                comes from the record, which PIPELINED_STATS saves a
+**                year late.
+**
+*/
+static void
+  stats_save_record (BOOLEAN urban_year)                     /* IN     */
+{
+  char filename[MAX_FILENAME_LEN];
+
+  if (urban_year)
+  {
     sprintf (filename, "%sgrow_%u_%u.log",
-    scen_GetOutputDir (), proc_GetCurrentRun (), proc_GetCurrentYear ());
+    scen_GetOutputDir (), record.run, record.year);
 
     /*VerD*/
     if (proc_GetProcessingType () != PREDICTING)
 	{
 	    if (WriteXypointsFileFlag == 1)
 		{
-			fprintf (fpVerD2, "%6d %6d %6.0f %6.0f %6.0f %6.0f %6.0f %6d %6d\n",
-				proc_GetCurrentRun(),
-				proc_GetCurrentMonteCarlo(),
+			fprintf (deferring_output ? deferred_xypoints : fpVerD2,
+				"%6d %6d %6.0f %6.0f %6.0f %6.0f %6.0f %6d %6d\n",
+				record.run,
+				record.monte_carlo,
 
-				coeff_GetCurrentDiffusion(),
-				coeff_GetCurrentBreed(),
-				coeff_GetCurrentSpread(),
-				coeff_GetCurrentSlopeResist(),
-				coeff_GetCurrentRoadGravity(),
+				record.this_year.diffusion,
+				record.this_year.breed,
+				record.this_year.spread,
+				record.this_year.slope_resistance,
+				record.this_year.road_gravity,
 
-				proc_GetCurrentYear (),
+				record.year,
 
 				stats_GetArea()      );
 		}
@@ -591,7 +785,7 @@ void
   if (proc_GetProcessingType () == PREDICTING)
   {
     sprintf (filename, "%sgrow_%u_%u.log", scen_GetOutputDir (),
-             proc_GetCurrentRun (), proc_GetCurrentYear ());
+             record.run, record.year);
     stats_Save (filename);
   }
 }
@@ -725,6 +919,49 @@ static void
 }
 /******************************************************************************
 *******************************************************************************
+** FUNCTION NAME: stats_DeferOutput
+** PURPOSE:       hold back this thread's grow file records and
+**                xypoints lines, or write them
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                While deferred, stats_Save only remembers the records
+**                of the calling thread; turning deferral off adds them
+**                to the running totals and writes them in the order
+**                they were made, so the sums are the serial ones.
+**
+*/
+void
+  stats_DeferOutput (BOOLEAN defer)                          /* IN     */
+{
+  int i;
+
+  if (defer)
+  {
+    if (WriteXypointsFileFlag == 1)
+    {
+      deferred_xypoints = util_OpenDeferred (deferred_xypoints);
+    }
+    deferring_output = TRUE;
+  }
+  else if (deferring_output)
+  {
+    deferring_output = FALSE;
+    for (i = 0; i < deferred_count; i++)
+    {
+      record = deferred_records[i].record;
+      stats_write_record (deferred_records[i].filename);
+    }
+    deferred_count = 0;
+    if (deferred_xypoints != NULL)
+    {
+      util_FlushDeferred (deferred_xypoints, fpVerD2);
+    }
+  }
+}
+/******************************************************************************
+*******************************************************************************
 ** FUNCTION NAME: stats_UpdateRunningTotal
 ** PURPOSE:       
 ** AUTHOR:        Keith Clarke
@@ -811,6 +1048,30 @@ double
 }
 /******************************************************************************
 *******************************************************************************
+** FUNCTION NAME: stats_ClearUrbanMasks
+** PURPOSE:       mark the urban input masks as not yet packed
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                stats_CalLeesalee packs each urban input grid into its
+**                mask the first time it is needed; igrid_ReadFiles
+**                calls this once the grids are read, so a mask is never
+**                left over from other grids.
+**
+*/
+void
+  stats_ClearUrbanMasks ()
+{
+  int i;
+
+  for (i = 0; i < MAX_URBAN_YEARS; i++)
+  {
+    urban_mask_built[i] = FALSE;
+  }
+}
+/******************************************************************************
+*******************************************************************************
 ** FUNCTION NAME: stats_CalLeesalee
 ** PURPOSE:       
 ** AUTHOR:        Keith Clarke
@@ -826,12 +1087,40 @@ static void
   char func[] = "stats_CalLeesalee";
   GRID_P z_ptr;
   GRID_P urban_ptr;
+  MASK_WORD *urban_mask;
+  int index;
+  int the_union;
+  int intersection;
 
   z_ptr = pgrid_GetZPtr ();
   urban_ptr = igrid_GetUrbanGridPtrByYear (__FILE__, func,
                                        __LINE__, proc_GetCurrentYear ());
   record.this_year.leesalee = 1.0;
-  if (proc_GetProcessingType () != PREDICTING)
+  if ((proc_GetProcessingType () != PREDICTING) &&
+      (z_ptr == mem_GetGRZpointer ()) && (mem_GetZMaskPtr () != NULL))
+  {
+    /*
+     *
+     * THE URBAN INPUT GRIDS NEVER CHANGE, SO EACH ONE IS PACKED ONCE
+     *
+     */
+    index = igrid_UrbanYear2Index (proc_GetCurrentYear ());
+    urban_mask = mem_GetUrbanMaskPtr (index);
+#ifdef _OPENMP
+#pragma omp critical (stats_urban_mask)
+#endif
+    if (!urban_mask_built[index])
+    {
+      util_mask_from_grid (urban_ptr, urban_mask);
+      urban_mask_built[index] = TRUE;
+    }
+    util_mask_union_intersection (mem_GetZMaskPtr (),        /* IN     */
+                                  urban_mask,                /* IN     */
+                                  &the_union,                /* OUT    */
+                                  &intersection);          /* OUT    */
+    record.this_year.leesalee = (double) intersection / the_union;
+  }
+  else if (proc_GetProcessingType () != PREDICTING)
   {
     stats_compute_leesalee (z_ptr,                           /* IN     */
                             urban_ptr,                       /* IN     */
@@ -1485,6 +1774,548 @@ static void
                                        stats_workspace2);
 
 
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_use_grz
+** PURPOSE:       set the cumulative growth grid the loops may use
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                z is the grid whose urban pixels are offset[0] to
+**                offset[count - 1], and mask (if not NULL) its bit
+**                mask. stats_edge, stats_cluster and stats_circle use
+**                them for that grid instead of scanning it.
+**
+*/
+static void
+  stats_use_grz (GRID_P z,                                   /* IN     */
+                 int *offset,                                /* IN     */
+                 int count,                                  /* IN     */
+                 MASK_WORD * mask)                           /* IN     */
+{
+  grz_z = z;
+  zgrwth_offset = offset;
+  zgrwth_count = count;
+  grz_mask = mask;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_urban_count
+** PURPOSE:       count the urban pixels of z
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The pop stats_cluster finds; every entry of the
+**                cumulative growth list is urban and every urban pixel
+**                is in it.
+**
+*/
+static int
+  stats_urban_count (GRID_P z)                               /* IN     */
+{
+  int total_pixels;
+  int count;
+  int i;
+
+  if (z == grz_z)
+  {
+    return zgrwth_count;
+  }
+  total_pixels = mem_GetTotalPixels ();
+  count = 0;
+  for (i = 0; i < total_pixels; i++)
+  {
+    if (z[i] != 0)
+    {
+      count++;
+    }
+  }
+  return count;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_StartPipeline
+** PURPOSE:       have stats_Update hand its edge and cluster statistics
+**                to a helper thread
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                PIPELINED_STATS. Called by the growing thread before
+**                its years, with stats_PipelineHelper running on
+**                another thread. Until stats_EndPipeline, stats_Update
+**                computes what self-modification needs at once and the
+**                edges and clusters of a year to be saved on the
+**                helper, while the next year grows; the year's record
+**                is saved when the next one is done.
+**
+*/
+void
+  stats_StartPipeline ()
+{
+  char func[] = "stats_StartPipeline";
+  int total_pixels;
+  int mask_words;
+
+  FUNC_INIT;
+  if (pipeline_z == NULL)
+  {
+    total_pixels = mem_GetTotalPixels ();
+    mask_words = igrid_GetNumRows () *
+      MASK_WORDS_PER_ROW (igrid_GetNumCols ());
+    pipeline_z = (GRID_P) malloc (total_pixels * sizeof (PIXEL));
+    pipeline_scratch1 = (GRID_P) malloc (total_pixels * sizeof (PIXEL));
+    pipeline_scratch2 = (GRID_P) malloc (total_pixels * sizeof (PIXEL));
+    pipeline_offset = (int *) malloc (total_pixels * sizeof (int));
+    pipeline_mask = (MASK_WORD *) malloc (mask_words * sizeof (MASK_WORD));
+    if ((pipeline_z == NULL) || (pipeline_scratch1 == NULL) ||
+        (pipeline_scratch2 == NULL) || (pipeline_offset == NULL) ||
+        (pipeline_mask == NULL))
+    {
+      sprintf (msg_buf, "Unable to allocate the PIPELINED_STATS grids");
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+  }
+  pipeline_pending = FALSE;
+  pipeline_state = PIPELINE_IDLE;
+  pipeline_active = TRUE;
+  FUNC_END;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_EndPipeline
+** PURPOSE:       save the last record and let the helper thread go
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Called by the growing thread after its last year.
+**                Does nothing unless stats_StartPipeline was called.
+**
+*/
+void
+  stats_EndPipeline ()
+{
+  if (!pipeline_active)
+  {
+    return;
+  }
+  stats_wait_pipeline ();
+  stats_save_pending ();
+  pipeline_active = FALSE;
+#ifdef _OPENMP
+#pragma omp atomic write
+  pipeline_state = PIPELINE_STOP;
+#endif
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_PipelineHelper
+** PURPOSE:       compute the edge and cluster statistics handed over
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                The PIPELINED_STATS helper thread, until
+**                stats_EndPipeline. The statistics are computed as
+**                stats_compute_stats computes them, from the copy of Z
+**                stats_update_pipelined made.
+**
+*/
+void
+  stats_PipelineHelper ()
+{
+#ifdef _OPENMP
+  char func[] = "stats_PipelineHelper";
+  int state;
+  double area;
+  double edges;
+  double clusters;
+  double pop;
+  double mean_cluster_size;
+
+  FUNC_INIT;
+  for (;;)
+  {
+#pragma omp atomic read
+    state = pipeline_state;
+    if (state == PIPELINE_STOP)
+    {
+      break;
+    }
+    if (state != PIPELINE_POSTED)
+    {
+      sched_yield ();
+      continue;
+    }
+#pragma omp flush
+    stats_use_grz (pipeline_grz_z,                           /* IN     */
+                   pipeline_offset,                          /* IN     */
+                   pipeline_count,                           /* IN     */
+                   pipeline_grz_mask);                       /* IN     */
+    stats_edge (pipeline_z,                                  /* IN     */
+                &area,                                       /* OUT    */
+                &edges);                                     /* OUT    */
+    stats_cluster (pipeline_z,                               /* IN     */
+                   &clusters,                                /* OUT    */
+                   &pop,                                     /* OUT    */
+                   &mean_cluster_size,                       /* OUT    */
+                   pipeline_scratch1,                        /* MOD    */
+                   pipeline_scratch2);                       /* MOD    */
+    assert (pop == pipeline_record.this_year.pop);
+    pipeline_record.this_year.area = area;
+    pipeline_record.this_year.edges = edges;
+    pipeline_record.this_year.clusters = clusters;
+    pipeline_record.this_year.mean_cluster_size = mean_cluster_size;
+    pipeline_record.this_year.rad = pow (((int) area / PI), 0.5);
+#pragma omp flush
+#pragma omp atomic write
+    pipeline_state = PIPELINE_IDLE;
+  }
+  FUNC_END;
+#endif
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_update_pipelined
+** PURPOSE:       stats_Update with PIPELINED_STATS
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Saves last year's record once the helper is done
+**                with it, then computes this year's pop, means and
+**                growth rate at once. If this year's record is to be
+**                saved, Z is copied and its edges and clusters are
+**                left to the helper.
+**
+*/
+static void
+  stats_update_pipelined (int num_growth_pix)                /* IN     */
+{
+  char func[] = "stats_update_pipelined";
+  GRID_P z_ptr;
+  GRID_P slope_ptr;
+  double xmean;
+  double ymean;
+  double slope;
+  double rad;
+  BOOLEAN urban_year;
+
+  stats_wait_pipeline ();
+  stats_save_pending ();
+
+  z_ptr = pgrid_GetZPtr ();
+  assert (z_ptr != NULL);
+  slope_ptr = igrid_GetSlopeGridPtr (__FILE__, func, __LINE__);
+  stats_use_grz (mem_GetGRZpointer (),                       /* IN     */
+                 mem_GetGRZoffptr (),                        /* IN     */
+                 mem_GetGRZcount (),                         /* IN     */
+                 mem_GetZMaskPtr ());                        /* IN     */
+  stats_circle (z_ptr,                                       /* IN     */
+                slope_ptr,                                   /* IN     */
+                0,                                           /* IN     */
+                &xmean,                                      /* OUT    */
+                &ymean,                                      /* OUT    */
+                &slope,                                      /* OUT    */
+                &rad);                                       /* OUT    */
+  slope_ptr = igrid_GridRelease (__FILE__, func, __LINE__, slope_ptr);
+  record.this_year.pop = stats_urban_count (z_ptr);
+  record.this_year.xmean = xmean;
+  record.this_year.ymean = ymean;
+  record.this_year.slope = slope;
+  record.this_year.diffusion = coeff_GetCurrentDiffusion ();
+  record.this_year.spread = coeff_GetCurrentSpread ();
+  record.this_year.breed = coeff_GetCurrentBreed ();
+  record.this_year.slope_resistance = coeff_GetCurrentSlopeResist ();
+  record.this_year.road_gravity = coeff_GetCurrentRoadGravity ();
+
+  urban_year = stats_measure_record (num_growth_pix, TRUE);
+  if (!urban_year && (proc_GetProcessingType () != PREDICTING))
+  {
+    return;
+  }
+
+  /*
+   *
+   * HAND THE YEAR OVER
+   *
+   */
+  memcpy (pipeline_z, z_ptr, mem_GetTotalPixels () * sizeof (PIXEL));
+  pipeline_grz_z = NULL;
+  pipeline_grz_mask = NULL;
+  pipeline_count = 0;
+  if (z_ptr == grz_z)
+  {
+    memcpy (pipeline_offset, zgrwth_offset, zgrwth_count * sizeof (int));
+    pipeline_count = zgrwth_count;
+    pipeline_grz_z = pipeline_z;
+    if (grz_mask != NULL)
+    {
+      memcpy (pipeline_mask, grz_mask, igrid_GetNumRows () *
+              MASK_WORDS_PER_ROW (igrid_GetNumCols ()) * sizeof (MASK_WORD));
+      pipeline_grz_mask = pipeline_mask;
+    }
+  }
+  pipeline_record = record;
+  pipeline_urban_year = urban_year;
+  pipeline_pending = TRUE;
+#ifdef _OPENMP
+#pragma omp flush
+#pragma omp atomic write
+  pipeline_state = PIPELINE_POSTED;
+#endif
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_wait_pipeline
+** PURPOSE:       wait until the helper is done with the year handed over
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+static void
+  stats_wait_pipeline ()
+{
+#ifdef _OPENMP
+  int state;
+
+  for (;;)
+  {
+#pragma omp atomic read
+    state = pipeline_state;
+    if (state != PIPELINE_POSTED)
+    {
+      break;
+    }
+    sched_yield ();
+  }
+#pragma omp flush
+#endif
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_save_pending
+** PURPOSE:       save the record the helper finished
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+static void
+  stats_save_pending ()
+{
+  stats_record_t this_year;
+
+  if (!pipeline_pending)
+  {
+    return;
+  }
+  this_year = record;
+  record = pipeline_record;
+  stats_save_record (pipeline_urban_year);
+  record = this_year;
+  pipeline_pending = FALSE;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_ComputeReplicaStats
+** PURPOSE:       compute this year's edge, cluster and Lee-Salee
+**                statistics of every replica of a batch
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                BIT_SLICED_REPLICAS. Edges and the Lee-Salee
+**                intersection are counted for all replicas at once
+**                with lane counters over the replica pixel list, with
+**                the tests of stats_edge and stats_compute_leesalee.
+**                Clusters are found replica by replica as stats_cluster
+**                finds them, over interior pixels only, using bits of
+**                the replica scratch grid as the visited marks and the
+**                lane list as the queue. pop holds each replica's
+**                urban pixel count. Only called in urban years.
+**
+*/
+void
+  stats_ComputeReplicaStats (int nlanes,                     /* IN     */
+                             int *pop,                       /* IN     */
+                             int *edges,                     /* OUT    */
+                             int *clusters,                  /* OUT    */
+                             double *mean_cluster_size,      /* OUT    */
+                             double *leesalee)               /* OUT    */
+{
+  char func[] = "stats_ComputeReplicaStats";
+  int step[4];
+  int inter[REPLICA_LANES];
+  MASK_WORD planes[LANE_PLANES];
+  MASK_WORD cross_planes[LANE_PLANES];
+  MASK_WORD bit;
+  MASK_WORD n;
+  MASK_WORD s;
+  MASK_WORD e;
+  MASK_WORD w;
+  MASK_WORD *z;
+  MASK_WORD *visited;
+  GRID_P urban_ptr;
+  int *zlist;
+  int *queue;
+  int zcount;
+  int total_pixels;
+  int nrows;
+  int ncols;
+  int urban_count;
+  int lane;
+  int k;
+  int loop;
+  int offset;
+  int nbr;
+  int row;
+  int col;
+  int head;
+  int tail;
+  int sum;
+  int num_clusters;
+
+  urban_ptr = igrid_GetUrbanGridPtrByYear (__FILE__, func,
+                                       __LINE__, proc_GetCurrentYear ());
+  FUNC_INIT;
+  assert ((nlanes > 0) && (nlanes <= REPLICA_LANES));
+  assert (pop != NULL);
+  assert (edges != NULL);
+  assert (clusters != NULL);
+  assert (mean_cluster_size != NULL);
+  assert (leesalee != NULL);
+  total_pixels = mem_GetTotalPixels ();
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  z = mem_GetReplicaZPtr ();
+  visited = mem_GetReplicaWorkPtr ();
+  zlist = mem_GetReplicaZListPtr ();
+  zcount = mem_GetReplicaZCount ();
+  queue = mem_GetReplicaLaneListPtr ();
+  step[0] = -ncols;
+  step[1] = ncols;
+  step[2] = -1;
+  step[3] = 1;
+
+  /*
+   *
+   * EDGES AND THE LEE-SALEE INTERSECTION; OFF THE IMAGE COUNTS AS URBAN
+   *
+   */
+  memset (planes, 0, sizeof (planes));
+  memset (cross_planes, 0, sizeof (cross_planes));
+  for (k = 0; k < zcount; k++)
+  {
+    offset = zlist[k];
+    row = offset / ncols;
+    col = offset % ncols;
+    n = (row > 0) ? z[offset - ncols] : ~(MASK_WORD) 0;
+    s = (row < nrows - 1) ? z[offset + ncols] : ~(MASK_WORD) 0;
+    w = (col > 0) ? z[offset - 1] : ~(MASK_WORD) 0;
+    e = (col < ncols - 1) ? z[offset + 1] : ~(MASK_WORD) 0;
+    util_lane_count_add (planes, z[offset] & ~(n & s & e & w));
+    if (urban_ptr[offset] > 0)
+    {
+      util_lane_count_add (cross_planes, z[offset]);
+    }
+  }
+  util_lane_counts (planes, nlanes, edges);
+  util_lane_counts (cross_planes, nlanes, inter);
+
+  urban_count = 0;
+  for (k = 0; k < total_pixels; k++)
+  {
+    if (urban_ptr[k] > 0)
+    {
+      urban_count++;
+    }
+  }
+  for (lane = 0; lane < nlanes; lane++)
+  {
+    leesalee[lane] = (double) inter[lane] /
+      (urban_count + pop[lane] - inter[lane]);
+  }
+
+  /*
+   *
+   * CLUSTERS
+   *
+   */
+  for (lane = 0; lane < nlanes; lane++)
+  {
+    bit = LANE_BIT (lane);
+    sum = 0;
+    num_clusters = 0;
+    for (k = 0; k < zcount; k++)
+    {
+      offset = zlist[k];
+      row = offset / ncols;
+      col = offset % ncols;
+      if ((row < 1) || (row >= nrows - 1) || (col < 1) || (col >= ncols - 1))
+      {
+        continue;
+      }
+      if (((z[offset] & bit) == 0) || (visited[offset] & bit))
+      {
+        continue;
+      }
+      visited[offset] |= bit;
+      queue[0] = offset;
+      head = 0;
+      tail = 1;
+      while (head < tail)
+      {
+        offset = queue[head++];
+        for (loop = 0; loop <= 3; loop++)
+        {
+          nbr = offset + step[loop];
+          row = nbr / ncols;
+          col = nbr % ncols;
+          if ((row < 1) || (row >= nrows - 1) ||
+              (col < 1) || (col >= ncols - 1))
+          {
+            continue;
+          }
+          if ((z[nbr] & bit) && !(visited[nbr] & bit))
+          {
+            visited[nbr] |= bit;
+            queue[tail++] = nbr;
+          }
+        }
+      }
+      sum += tail;
+      num_clusters++;
+    }
+    clusters[lane] = num_clusters;
+    if (num_clusters > 0)
+    {
+      mean_cluster_size[lane] = sum / num_clusters;
+    }
+    else
+    {
+      sprintf (msg_buf, "num_clusters=%d", num_clusters);
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+  }
+  for (k = 0; k < zcount; k++)
+  {
+    visited[zlist[k]] = 0;
+  }
+
+  urban_ptr = igrid_GridRelease (__FILE__, func, __LINE__, urban_ptr);
+  FUNC_END;
 }
 /******************************************************************************
 *******************************************************************************
@@ -1894,6 +2725,11 @@ void
     stats_DoRegressions ();
     stats_DoAggregate (fmatch);
     stats_WriteControlStats (cntrl_filename);
+    last_control.regression = regression;
+    last_control.product = aggregate.product;
+    last_control.compare = aggregate.compare;
+    last_control.leesalee = aggregate.leesalee;
+    last_control.fmatch = aggregate.fmatch;
   }
   if (proc_GetProcessingType () == PREDICTING)
   {
@@ -1921,6 +2757,55 @@ void
 }
 /******************************************************************************
 *******************************************************************************
+** FUNCTION NAME: stats_GetControlStats
+** PURPOSE:       return what stats_Analysis wrote to control_stats.log
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Valid after a calibration run's stats_Analysis or
+**                stats_ReplicateAnalysis.
+**
+**
+*/
+void
+  stats_GetControlStats (stats_control_t * control)          /* OUT    */
+{
+  assert (control != NULL);
+  *control = last_control;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_ReplicateAnalysis
+** PURPOSE:       write the control statistics of an equivalent run
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                SKIP_EQUIVALENT_RUNS. Appends control to
+**                control_stats.log as the current run, with the
+**                current run's coefficients. The run that control came
+**                from has created the file already.
+**
+*/
+void
+  stats_ReplicateAnalysis (stats_control_t * control)        /* IN     */
+{
+  char cntrl_filename[MAX_FILENAME_LEN];
+
+  assert (control != NULL);
+  regression = control->regression;
+  aggregate.product = control->product;
+  aggregate.compare = control->compare;
+  aggregate.leesalee = control->leesalee;
+  aggregate.fmatch = control->fmatch;
+  last_control = *control;
+  sprintf (cntrl_filename, "%scontrol_stats_pe_%u.log",
+           scen_GetOutputDir (), glb_mype);
+  stats_WriteControlStats (cntrl_filename);
+}
+/******************************************************************************
+*******************************************************************************
 ** FUNCTION NAME: stats_Dump
 ** PURPOSE:       
 ** AUTHOR:        Keith Clarke
@@ -2411,14 +3296,50 @@ static void
   stats_Save (char *filename)
 {
   char func[] = "stats_Save";
+
+  if (deferring_output)
+  {
+    if (deferred_count == deferred_size)
+    {
+      deferred_size = deferred_size ? 2 * deferred_size : 32;
+      deferred_records = (stats_deferred_t *)
+        realloc (deferred_records, deferred_size * sizeof (stats_deferred_t));
+      if (deferred_records == NULL)
+      {
+        sprintf (msg_buf, "Unable to allocate %d deferred records",
+                 deferred_size);
+        LOG_ERROR (msg_buf);
+        EXIT (1);
+      }
+    }
+    strcpy (deferred_records[deferred_count].filename, filename);
+    deferred_records[deferred_count].record = record;
+    deferred_count++;
+    return;
+  }
+  stats_write_record (filename);
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_write_record
+** PURPOSE:       add the record to the running totals and its grow file
+** AUTHOR:        Keith Clarke
+** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
+** CREATION DATE: 11/11/1999
+** DESCRIPTION:
+**                The tail of stats_Save, which stats_DeferOutput also
+**                uses to replay held back records.
+**
+*/
+static void
+  stats_write_record (char *filename)
+{
+  char func[] = "stats_write_record";
   int num_written;
   int fseek_loc;
   int index;
   int i;
   FILE *fp;
-  record.run = proc_GetCurrentRun ();
-  record.monte_carlo = proc_GetCurrentMonteCarlo ();
-  record.year = proc_GetCurrentYear ();
   index = 0;
   if (proc_GetProcessingType () != PREDICTING)
   {
@@ -2780,9 +3701,10 @@ static void
   assert (scratch_gif2 != NULL);
 
 /** D. Donato 8/21/2006 Added to deal with cumulative growth                 **/
-  zgrwth_row = (short *)  mem_GetGRZrowptr();
-  zgrwth_col = (short *)  mem_GetGRZcolptr();
-  zgrwth_count =          mem_GetGRZcount();
+  stats_use_grz (mem_GetGRZpointer (),                       /* IN     */
+                 mem_GetGRZoffptr (),                        /* IN     */
+                 mem_GetGRZcount (),                         /* IN     */
+                 mem_GetZMaskPtr ());                        /* IN     */
 /******************* 8/21/2006  ***********************************************/
 
   /*
@@ -2852,6 +3774,11 @@ static void
   int col;
   int nrows;
   int ncols;
+  int first_row;
+  int last_row;
+  int first_col;
+  int last_col;
+  BOOLEAN interior;
 
   FUNC_INIT;
   assert (stats_area != NULL);
@@ -2876,12 +3803,19 @@ static void
 
 *********************     8/21/2006    **************************/
 
- if (Z == mem_GetGRZpointer())
+ if ((Z == grz_z) && (grz_mask != NULL))
+ {
+    util_mask_edges (grz_mask,                               /* IN     */
+                     &area,                                  /* OUT    */
+                     &edges);                              /* OUT    */
+ }
+
+ else if (Z == grz_z)
  {
     for ( k = 0; k < zgrwth_count; k++)
     {
-      i = zgrwth_row[k];
-      j = zgrwth_col[k];
+      i = zgrwth_offset[k] / ncols;
+      j = zgrwth_offset[k] % ncols;
 
       edge = FALSE;
 
@@ -2889,13 +3823,16 @@ static void
       {
         area++;
 
+        /* only border pixels have neighbors off the image */
+        interior = (i > 0) && (i < nrows - 1) && (j > 0) && (j < ncols - 1);
+
         /* this does a 4 neighbor search (N, S, E, W) */
         for (loop = 0; loop <= 3; loop++)
         {
           row = i + rowi[loop];
           col = j + colj[loop];
 
-          if (IMAGE_PT (row, col))
+          if (interior || IMAGE_PT (row, col))
           {
             if (Z[OFFSET (row, col)] == 0)
             {
@@ -2915,9 +3852,11 @@ static void
  else
 
  {
-  for (i = 0; i < nrows; i++)
+  /* Z is zero outside the active window */
+  mem_GetActiveWindow (&first_row, &last_row, &first_col, &last_col);
+  for (i = first_row; i <= last_row; i++)
   {
-    for (j = 0; j < ncols; j++)
+    for (j = first_col; j <= last_col; j++)
     {
       edge = FALSE;
 
@@ -2925,13 +3864,16 @@ static void
       {
         area++;
 
+        /* only border pixels have neighbors off the image */
+        interior = (i > 0) && (i < nrows - 1) && (j > 0) && (j < ncols - 1);
+
         /* this does a 4 neighbor search (N, S, E, W) */
         for (loop = 0; loop <= 3; loop++)
         {
           row = i + rowi[loop];
           col = j + colj[loop];
 
-          if (IMAGE_PT (row, col))
+          if (interior || IMAGE_PT (row, col))
           {
             if (Z[OFFSET (row, col)] == 0)
             {
@@ -3020,22 +3962,32 @@ static void
 *********************     8/21/2006    **************************/
 
 
- if (Z == mem_GetGRZpointer())
+ if (Z == grz_z)
  {
 
-    for ( k = 0; k < zgrwth_count; k++)
+    /* only the entries spr_spread has not summed are visited */
+    if (growth_sums.summed > zgrwth_count)
     {
-      i = zgrwth_row[k];
-      j = zgrwth_col[k];
+      stats_ResetGrowthSums ();
+    }
+    for ( k = growth_sums.summed; k < zgrwth_count; k++)
+    {
+      i = zgrwth_offset[k] / ncols;
+      j = zgrwth_offset[k] % ncols;
 
       if (Z[OFFSET (i, j)] > 0)
       {
-        addslope += slp[OFFSET (i, j)];
-        xmean += (double) j;
-        ymean += (double) i;
-        number++;
+        growth_sums.slope += slp[OFFSET (i, j)];
+        growth_sums.xsum += (double) j;
+        growth_sums.ysum += (double) i;
+        growth_sums.number++;
       }
     }
+    growth_sums.summed = zgrwth_count;
+    addslope = growth_sums.slope;
+    xmean = growth_sums.xsum;
+    ymean = growth_sums.ysum;
+    number = growth_sums.number;
  }
 
  else
@@ -3139,9 +4091,13 @@ static void
 ***^^**^^**/
   PIXEL *visited;
   PIXEL *clusters;
-  int total_pixels;
   int nrows;
   int ncols;
+  int first_row;
+  int last_row;
+  int first_col;
+  int last_col;
+  int offset;
 
   FUNC_INIT;
   assert (stats_clusters != NULL);
@@ -3150,8 +4106,6 @@ static void
   assert (Z != NULL);
   assert (scratch_gif1 != NULL);
   assert (scratch_gif2 != NULL);
-  total_pixels = mem_GetTotalPixels ();
-  assert (total_pixels > 0);
   nrows = igrid_GetNumRows ();
   ncols = igrid_GetNumCols ();
   assert (nrows > 0);
@@ -3164,22 +4118,32 @@ static void
 
   visited = scratch_gif1;
   clusters = scratch_gif2;
-  for (i = 0; i < total_pixels; i++)
-  {
-    visited[i] = 0;
-/** D.D. 8/21/2006 The next three lines are unnecessary and inefficient. ***
-  }
-  for (i = 0; i < total_pixels; i++)
+
+  /*
+   * Z is zero outside the active window (the whole image without
+   * ACTIVE_DOMAIN), so only the window and the ring of pixels around
+   * it, which the flood fill reads, are set up and scanned.
+   */
+  mem_GetActiveWindow (&first_row, &last_row, &first_col, &last_col);
+  first_row = MAX (first_row - 1, 0);
+  last_row = MIN (last_row + 1, nrows - 1);
+  first_col = MAX (first_col - 1, 0);
+  last_col = MIN (last_col + 1, ncols - 1);
+  for (i = first_row; i <= last_row; i++)
   {
-*** D.D. 8/21/2006                        *********************************/
-    if (Z[i] != 0)
-    {
-      clusters[i] = 1;
-      (*stats_pop)++;
-    }
-    else
+    for (j = first_col; j <= last_col; j++)
     {
-      clusters[i] = 0;
+      offset = i * ncols + j;
+      visited[offset] = 0;
+      if (Z[offset] != 0)
+      {
+        clusters[offset] = 1;
+        (*stats_pop)++;
+      }
+      else
+      {
+        clusters[offset] = 0;
+      }
     }
   }
   for (j = 0; j < ncols; j++)
@@ -3205,12 +4169,12 @@ static void
 
 *********************     8/21/2006    **************************/
 
- if (Z == mem_GetGRZpointer())
+ if (Z == grz_z)
  {
     for ( k = 0; k < zgrwth_count; k++)
     {
-      i = zgrwth_row[k];
-      j = zgrwth_col[k];
+      i = zgrwth_offset[k] / ncols;
+      j = zgrwth_offset[k] % ncols;
       
       if (clusters[OFFSET (i, j)] == 1 && visited[OFFSET (i, j)] == 0)
       {
@@ -3227,16 +4191,15 @@ static void
             rrow = row + rowi[loop];
             ccol = col + colj[loop];
 
-            if (IMAGE_PT (rrow, ccol))
+            /* clusters is 0 on the border, so only interior pixels */
+            /* are queued and every neighbor is on the image        */
+            if (clusters[OFFSET (rrow, ccol)] == 1 &&
+                !visited[OFFSET (rrow, ccol)])
             {
-              if (clusters[OFFSET (rrow, ccol)] == 1 &&
-                  !visited[OFFSET (rrow, ccol)])
-              {
-                visited[OFFSET (rrow, ccol)] = 1;
-                Q_STORE (rrow, ccol);
-
-                sum++;
-              }
+              visited[OFFSET (rrow, ccol)] = 1;
+              Q_STORE (rrow, ccol);
+
+              sum++;
             }
           }
         }
@@ -3250,9 +4213,9 @@ static void
 
  {
 
-  for (i = 0; i < nrows; i++)
+  for (i = first_row; i <= last_row; i++)
   {
-    for (j = 0; j < ncols; j++)
+    for (j = first_col; j <= last_col; j++)
     {
       if (clusters[OFFSET (i, j)] == 1 && visited[OFFSET (i, j)] == 0)
       {
@@ -3269,16 +4232,15 @@ static void
             rrow = row + rowi[loop];
             ccol = col + colj[loop];
 
-            if (IMAGE_PT (rrow, ccol))
+            /* clusters is 0 on the border, so only interior pixels */
+            /* are queued and every neighbor is on the image        */
+            if (clusters[OFFSET (rrow, ccol)] == 1 &&
+                !visited[OFFSET (rrow, ccol)])
             {
-              if (clusters[OFFSET (rrow, ccol)] == 1 &&
-                  !visited[OFFSET (rrow, ccol)])
-              {
-                visited[OFFSET (rrow, ccol)] = 1;
-                Q_STORE (rrow, ccol);
-
-                sum++;
-              }
+              visited[OFFSET (rrow, ccol)] = 1;
+              Q_STORE (rrow, ccol);
+
+              sum++;
             }
           }
         }
@@ -3409,6 +4371,7 @@ void
   urbanization_attempt.delta_failure = 0;
   urbanization_attempt.slope_failure = 0;
   urbanization_attempt.excluded_failure = 0;
+  urbanization_attempt.skipped_draws = 0;
 }
 /******************************************************************************
 *******************************************************************************
@@ -3444,6 +4407,11 @@ void
   fprintf (fp, "Num Exlcuded Type Failures = %u\n",
            urbanization_attempt.excluded_failure);
   fprintf (fp, "Total Attempts             = %u\n", total);
+  if (scen_GetEligibleCellSamplingFlag ())
+  {
+    fprintf (fp, "Num Skipped Draws          = %ld\n",
+             urbanization_attempt.skipped_draws);
+  }
 }
 /******************************************************************************
 *******************************************************************************
@@ -3525,3 +4493,70 @@ void
 {
   urbanization_attempt.excluded_failure++;
 }
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_AddSkippedDraws
+** PURPOSE:       
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Counts phase 1 draws that ELIGIBLE_CELL_SAMPLING never
+**                simulated because they would have missed every pixel
+**                that can urbanize.
+**
+*/
+void
+  stats_AddSkippedDraws (int count)
+{
+  urbanization_attempt.skipped_draws += count;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_ResetGrowthSums
+** PURPOSE:       forget the sums over the cumulative growth list
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Called when grw_grow empties the list for a new Monte
+**                Carlo iteration.
+**
+*/
+void
+  stats_ResetGrowthSums ()
+{
+  growth_sums.summed = 0;
+  growth_sums.number = 0;
+  growth_sums.slope = 0.0;
+  growth_sums.xsum = 0.0;
+  growth_sums.ysum = 0.0;
+}
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: stats_AddGrowthSums
+** PURPOSE:       add one year's growth to the cumulative growth sums
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   spr_spread reports the count, slope sum and column and
+**                row sums of the number entries it appended to the
+**                cumulative growth list at index first. They are only
+**                taken if they continue the entries already summed;
+**                otherwise stats_circle sums the gap itself.
+**
+*/
+void
+  stats_AddGrowthSums (int first,
+                       int number,
+                       double slope,
+                       double xsum,
+                       double ysum)
+{
+  if (first == growth_sums.summed)
+  {
+    growth_sums.summed += number;
+    growth_sums.number += number;
+    growth_sums.slope += slope;
+    growth_sums.xsum += xsum;
+    growth_sums.ysum += ysum;
+  }
+}
@@ -24,6 +24,15 @@ typedef struct
    double percent_urban;
 }  stats_info;
 
+typedef struct
+{
+   stats_info regression;
+   double product;
+   double compare;
+   double leesalee;
+   double fmatch;
+}  stats_control_t;
+
 typedef struct
 {
   double sng;
@@ -69,8 +78,19 @@ void stats_ConcatenateAvgFiles(int current_run);
 #endif
 void stats_Dump(char* file, int line);
 void stats_Init();
+void stats_ClearUrbanMasks();
 void stats_Analysis(double fmatch);
+void stats_GetControlStats(stats_control_t* control);
+void stats_ReplicateAnalysis(stats_control_t* control);
 void stats_Update(int num_growth_pix);
+void stats_UpdateReplica(int num_growth_pix, stats_val_t* values);
+void stats_ComputeReplicaStats(int nlanes, int* pop, int* edges,
+                               int* clusters, double* mean_cluster_size,
+                               double* leesalee);
+void stats_DeferOutput(BOOLEAN defer);
+void stats_StartPipeline();
+void stats_EndPipeline();
+void stats_PipelineHelper();
 void stats_SetSNG(int val) ;
 void stats_SetSDG(int val) ;
 void stats_SetOG(int val) ;
@@ -119,5 +139,9 @@ void stats_IncrementDeltaFailure();
 void stats_IncrementSlopeFailure();
 void stats_CreateControlFile (char *filename);
 void stats_IncrementEcludedFailure();
+void stats_AddSkippedDraws(int count);
+void stats_ResetGrowthSums();
+void stats_AddGrowthSums(int first, int number, double slope,
+                         double xsum, double ysum);
 void stats_CreateStatsValFile (char *filename);
 #endif
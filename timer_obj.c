@@ -4,6 +4,9 @@
 #include <string.h>
 #include <errno.h>
 #include <ctype.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "timer_obj.h"
 #include "scenario_obj.h"
 #include "ugm_defines.h"
@@ -86,7 +89,7 @@ void
   char func[] = "timer_Init";
   int i;
 
-  actual_num_timers = 12;
+  actual_num_timers = 13;
   if (actual_num_timers > MAX_NUM_TIMERS)
   {
     sprintf (msg_buf, "actual_num_timers > MAX_NUM_TIMERS");
@@ -105,6 +108,7 @@ void
   strcpy (array[9].name, "grw_growth");
   strcpy (array[10].name, "drv_driver");
   strcpy (array[11].name, "main");
+  strcpy (array[12].name, "spr_plan");
 
   for (i = 0; i < actual_num_timers; i++)
   {
@@ -129,6 +133,13 @@ void
   timer_Start (int val)
 {
   char func[] = "timer_Start";
+#ifdef _OPENMP
+  /* a PARALLEL_MONTE_CARLO thread; the master times the whole pool */
+  if (omp_in_parallel ())
+  {
+    return;
+  }
+#endif
   if ((val < 0) || (val > actual_num_timers))
   {
     sprintf (msg_buf, "(val < 0) || (val > actual_num_timers)");
@@ -192,6 +203,12 @@ void
   timer_Stop (int val)
 {
   char func[] = "timer_Stop";
+#ifdef _OPENMP
+  if (omp_in_parallel ())
+  {
+    return;
+  }
+#endif
   if ((val < 0) || (val > actual_num_timers))
   {
     sprintf (msg_buf, "(val < 0) || (val > actual_num_timers)");
@@ -11,6 +11,7 @@
 #define GRW_GROWTH 9
 #define DRV_DRIVER 10
 #define TOTAL_TIME 11
+#define SPR_PLAN 12
 
 void timer_Init();
 void timer_Start(int val);
@@ -23,6 +23,7 @@
 #define TESTING 3
 #define PIXEL unsigned char
 #define GRID_P PIXEL*
+#define MASK_WORD unsigned long long
 #define BOOLEAN int
 #define MAX_FILENAME_LEN 150
 #define RED_MASK   0XFF0000
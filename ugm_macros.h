@@ -9,6 +9,9 @@
   extern char glb_call_stack[CALL_STACK_SIZE][MAX_FILENAME_LEN];
   extern int glb_call_stack_index;
 #endif
+#ifdef _OPENMP
+#pragma omp threadprivate (glb_call_stack, glb_call_stack_index)
+#endif
 
 #ifdef MPI
   #define EXIT(code) MPI_Abort(MPI_COMM_WORLD,code)
@@ -32,15 +35,19 @@
           __FILE__,__LINE__,#x,(x))
 
 #ifndef lint
+  /* The address is printed as the low int of the pointer, and size */
+  /* (a sizeof) and count as unsigned, so the formats match on LP64. */
   #define LOG_MEM_CHAR_ARRAY(fp,ptr,size,count)                           \
-        fprintf(fp,"%d s %-27s size=%5u bytes count=%4u %s %u\n",         \
-               (ptr),#ptr,(size),(count),__FILE__,__LINE__)
+        fprintf(fp,"%d s %-27s size=%5u bytes count=%4u %s %d\n",         \
+               (int)(size_t)(ptr),#ptr,(unsigned)(size),(unsigned)(count), \
+               __FILE__,__LINE__)
 
   #define LOG_MEM(fp,ptr,size,count)                                      \
-        fprintf(fp,"%d s %-27s size=%5u bytes count=%4u %s %u\n",         \
-               (ptr),#ptr,(size),(count),__FILE__,__LINE__);              \
-        fprintf(fp,"%d e %-27s END OF %s %u\n",                           \
-               (ptr)+count,#ptr,__FILE__,__LINE__)
+        fprintf(fp,"%d s %-27s size=%5u bytes count=%4u %s %d\n",         \
+               (int)(size_t)(ptr),#ptr,(unsigned)(size),(unsigned)(count), \
+               __FILE__,__LINE__);                                        \
+        fprintf(fp,"%d e %-27s END OF %s %d\n",                           \
+               (int)(size_t)((ptr)+count),#ptr,__FILE__,__LINE__)
 #else
   #define LOG_MEM_CHAR_ARRAY(fp,ptr,size,count)                           \
         fprintf(fp,"lint test\n")
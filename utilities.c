@@ -5,6 +5,7 @@
 #include <ctype.h>
 #include <math.h>
 #include <errno.h>
+#include <limits.h>
 #include "coeff_obj.h"
 #include "scenario_obj.h"
 #include "igrid_obj.h"
@@ -478,6 +479,20 @@ void
   FUNC_END;
 }
 
+/*
+ * NBR_COUNT counts the eight neighbors of the pixel p points at, in a
+ * grid ncols wide, for which (neighbor op value) holds.
+ */
+#define NBR_COUNT(p,ncols,op,value) \
+  ((((p)[-(ncols) - 1] op (value)) ? 1 : 0) + \
+   (((p)[-(ncols)] op (value)) ? 1 : 0) + \
+   (((p)[-(ncols) + 1] op (value)) ? 1 : 0) + \
+   (((p)[-1] op (value)) ? 1 : 0) + \
+   (((p)[1] op (value)) ? 1 : 0) + \
+   (((p)[(ncols) - 1] op (value)) ? 1 : 0) + \
+   (((p)[(ncols)] op (value)) ? 1 : 0) + \
+   (((p)[(ncols) + 1] op (value)) ? 1 : 0))
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: util_count_neighbors
@@ -486,7 +501,10 @@ void
 ** PROGRAMMER:    Tommy E. Cathey of NESC (919)541-1500
 ** CREATION DATE: 11/11/1999
 ** DESCRIPTION:
-**
+**                The grid dimensions are read once. An interior pixel
+**                compares its eight neighbors at fixed offsets; a
+**                border pixel counts only the neighbors inside the
+**                image.
 **
 */
 int
@@ -498,87 +516,824 @@ int
 {
   char func[] = "util_count_neighbors";
   int count = 0;
+  int nrows;
+  int ncols;
+  int row;
+  int col;
+  PIXEL pixel;
+  GRID_P p;
 
   FUNC_INIT;
   assert (grid != NULL);
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
 
-  switch (option)
+  if ((i > 0) && (i < nrows - 1) && (j > 0) && (j < ncols - 1))
   {
-  case LT:
-    count =
-      ((grid[OFFSET (i - 1, j - 1)] < value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j)] < value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j + 1)] < value) ? 1 : 0) +
-      ((grid[OFFSET (i, j - 1)] < value) ? 1 : 0) +
-      ((grid[OFFSET (i, j + 1)] < value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j - 1)] < value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j)] < value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j + 1)] < value) ? 1 : 0);
-    break;
-  case LE:
-    count =
-      ((grid[OFFSET (i - 1, j - 1)] <= value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j)] <= value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j + 1)] <= value) ? 1 : 0) +
-      ((grid[OFFSET (i, j - 1)] <= value) ? 1 : 0) +
-      ((grid[OFFSET (i, j + 1)] <= value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j - 1)] <= value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j)] <= value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j + 1)] <= value) ? 1 : 0);
-    break;
-  case EQ:
-    count =
-      ((grid[OFFSET (i - 1, j - 1)] == value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j)] == value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j + 1)] == value) ? 1 : 0) +
-      ((grid[OFFSET (i, j - 1)] == value) ? 1 : 0) +
-      ((grid[OFFSET (i, j + 1)] == value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j - 1)] == value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j)] == value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j + 1)] == value) ? 1 : 0);
-    break;
-  case NE:
-    count =
-      ((grid[OFFSET (i - 1, j - 1)] != value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j)] != value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j + 1)] != value) ? 1 : 0) +
-      ((grid[OFFSET (i, j - 1)] != value) ? 1 : 0) +
-      ((grid[OFFSET (i, j + 1)] != value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j - 1)] != value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j)] != value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j + 1)] != value) ? 1 : 0);
-    break;
-  case GE:
-    count =
-      ((grid[OFFSET (i - 1, j - 1)] >= value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j)] >= value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j + 1)] >= value) ? 1 : 0) +
-      ((grid[OFFSET (i, j - 1)] >= value) ? 1 : 0) +
-      ((grid[OFFSET (i, j + 1)] >= value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j - 1)] >= value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j)] >= value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j + 1)] >= value) ? 1 : 0);
-    break;
-  case GT:
-    count =
-      ((grid[OFFSET (i - 1, j - 1)] > value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j)] > value) ? 1 : 0) +
-      ((grid[OFFSET (i - 1, j + 1)] > value) ? 1 : 0) +
-      ((grid[OFFSET (i, j - 1)] > value) ? 1 : 0) +
-      ((grid[OFFSET (i, j + 1)] > value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j - 1)] > value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j)] > value) ? 1 : 0) +
-      ((grid[OFFSET (i + 1, j + 1)] > value) ? 1 : 0);
-    break;
-  default:
-    sprintf (msg_buf, "Unknown option = %d", option);
-    LOG_ERROR (msg_buf);
-    EXIT (1);
+    p = grid + i * ncols + j;
+    switch (option)
+    {
+    case LT:
+      count = NBR_COUNT (p, ncols, <, value);
+      break;
+    case LE:
+      count = NBR_COUNT (p, ncols, <=, value);
+      break;
+    case EQ:
+      count = NBR_COUNT (p, ncols, ==, value);
+      break;
+    case NE:
+      count = NBR_COUNT (p, ncols, !=, value);
+      break;
+    case GE:
+      count = NBR_COUNT (p, ncols, >=, value);
+      break;
+    case GT:
+      count = NBR_COUNT (p, ncols, >, value);
+      break;
+    default:
+      sprintf (msg_buf, "Unknown option = %d", option);
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+  }
+  else
+  {
+    for (row = MAX (i - 1, 0); row <= MIN (i + 1, nrows - 1); row++)
+    {
+      for (col = MAX (j - 1, 0); col <= MIN (j + 1, ncols - 1); col++)
+      {
+        if ((row == i) && (col == j))
+        {
+          continue;
+        }
+        pixel = grid[row * ncols + col];
+        switch (option)
+        {
+        case LT:
+          count += (pixel < value) ? 1 : 0;
+          break;
+        case LE:
+          count += (pixel <= value) ? 1 : 0;
+          break;
+        case EQ:
+          count += (pixel == value) ? 1 : 0;
+          break;
+        case NE:
+          count += (pixel != value) ? 1 : 0;
+          break;
+        case GE:
+          count += (pixel >= value) ? 1 : 0;
+          break;
+        case GT:
+          count += (pixel > value) ? 1 : 0;
+          break;
+        default:
+          sprintf (msg_buf, "Unknown option = %d", option);
+          LOG_ERROR (msg_buf);
+          EXIT (1);
+        }
+      }
+    }
   }
   FUNC_END;
   return (count);
 }
 
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_increment_neighbors
+** PURPOSE:       add one to the count of each neighbor of a pixel
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Keeps a neighbor count grid current when pixel (i,j)
+**                becomes urban. An interior pixel adds at fixed
+**                offsets; on the border, neighbors outside the image
+**                are skipped. Called for every pixel placed in z, so it
+**                does not push the call stack.
+**
+*/
+void
+  util_increment_neighbors (GRID_P count,                    /* IN/OUT */
+                            int i,                           /* IN     */
+                            int j)                           /* IN     */
+{
+  int nrows;
+  int ncols;
+  int row;
+  int col;
+
+  GRID_P p;
+
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  if ((i > 0) && (i < nrows - 1) && (j > 0) && (j < ncols - 1))
+  {
+    p = count + i * ncols + j;
+    p[-ncols - 1]++;
+    p[-ncols]++;
+    p[-ncols + 1]++;
+    p[-1]++;
+    p[1]++;
+    p[ncols - 1]++;
+    p[ncols]++;
+    p[ncols + 1]++;
+    return;
+  }
+  for (row = MAX (i - 1, 0); row <= MIN (i + 1, nrows - 1); row++)
+  {
+    for (col = MAX (j - 1, 0); col <= MIN (j + 1, ncols - 1); col++)
+    {
+      if ((row != i) || (col != j))
+      {
+        count[row * ncols + col]++;
+      }
+    }
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_clear_neighbors
+** PURPOSE:       zero the counts of a pixel and its neighbors
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**                Clearing around every urban pixel of z clears a
+**                neighbor count grid, since only those counts can be
+**                nonzero.
+**
+*/
+void
+  util_clear_neighbors (GRID_P count,                        /* IN/OUT */
+                        int i,                               /* IN     */
+                        int j)                               /* IN     */
+{
+  int nrows;
+  int ncols;
+  int row;
+  int col;
+
+  GRID_P p;
+
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  if ((i > 0) && (i < nrows - 1) && (j > 0) && (j < ncols - 1))
+  {
+    p = count + (i - 1) * ncols + j - 1;
+    p[0] = p[1] = p[2] = 0;
+    p += ncols;
+    p[0] = p[1] = p[2] = 0;
+    p += ncols;
+    p[0] = p[1] = p[2] = 0;
+    return;
+  }
+  for (row = MAX (i - 1, 0); row <= MIN (i + 1, nrows - 1); row++)
+  {
+    for (col = MAX (j - 1, 0); col <= MIN (j + 1, ncols - 1); col++)
+    {
+      count[row * ncols + col] = 0;
+    }
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_popcount64
+** PURPOSE:       count the set bits of a mask word
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+static int
+  util_popcount64 (MASK_WORD x)                              /* IN     */
+{
+  x = x - ((x >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return (int) ((x * 0x0101010101010101ULL) >> 56);
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_mask_word
+** PURPOSE:       fetch a mask word shifted by one column
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Returns word k of row with each bit replaced by its
+**                west (shift -1), own (0) or east (+1) neighbor. A NULL
+**                row or a column off the image reads as 0. With invert
+**                set the row is complemented first, padding excluded.
+**
+*/
+static MASK_WORD
+  util_mask_word (MASK_WORD * row,                           /* IN     */
+                  int k,                                     /* IN     */
+                  int wpr,                                   /* IN     */
+                  MASK_WORD tail,                            /* IN     */
+                  int shift,                                 /* IN     */
+                  int invert)                                /* IN     */
+{
+  MASK_WORD word;
+  MASK_WORD next;
+
+  if (row == NULL)
+  {
+    return 0;
+  }
+  word = row[k];
+  if (invert)
+  {
+    word = ~word & ((k == wpr - 1) ? tail : ~(MASK_WORD) 0);
+  }
+  if (shift < 0)
+  {
+    next = 0;
+    if (k > 0)
+    {
+      next = invert ? ~row[k - 1] : row[k - 1];
+    }
+    return (word << 1) | (next >> 63);
+  }
+  if (shift > 0)
+  {
+    next = 0;
+    if (k < wpr - 1)
+    {
+      next = invert ? ~row[k + 1] &
+        ((k + 1 == wpr - 1) ? tail : ~(MASK_WORD) 0) : row[k + 1];
+    }
+    return (word >> 1) | (next << 63);
+  }
+  return word;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_mask_from_grid
+** PURPOSE:       build the bit mask of the nonzero pixels of a grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  util_mask_from_grid (GRID_P grid,                          /* IN     */
+                       MASK_WORD * mask)                     /* OUT    */
+{
+  char func[] = "util_mask_from_grid";
+  int nrows;
+  int ncols;
+  int wpr;
+  int row;
+  int col;
+
+  FUNC_INIT;
+  assert (grid != NULL);
+  assert (mask != NULL);
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  wpr = MASK_WORDS_PER_ROW (ncols);
+  memset (mask, 0, nrows * wpr * sizeof (MASK_WORD));
+  for (row = 0; row < nrows; row++)
+  {
+    for (col = 0; col < ncols; col++)
+    {
+      if (grid[OFFSET (row, col)] != 0)
+      {
+        MASK_SET (mask, wpr, row, col);
+      }
+    }
+  }
+  FUNC_END;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_mask_popcount
+** PURPOSE:       count the set pixels of a bit mask
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+int
+  util_mask_popcount (MASK_WORD * mask)                      /* IN     */
+{
+  int i;
+  int words;
+  int count;
+
+  words = igrid_GetNumRows () * MASK_WORDS_PER_ROW (igrid_GetNumCols ());
+  count = 0;
+  for (i = 0; i < words; i++)
+  {
+    count += util_popcount64 (mask[i]);
+  }
+  return count;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_mask_union_intersection
+** PURPOSE:       count the pixels set in either and in both of two masks
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Bit mask form of the loop in stats_compute_leesalee.
+**
+**
+*/
+void
+  util_mask_union_intersection (MASK_WORD * mask1,           /* IN     */
+                                MASK_WORD * mask2,           /* IN     */
+                                int *the_union,              /* OUT    */
+                                int *intersection)           /* OUT    */
+{
+  int i;
+  int words;
+
+  words = igrid_GetNumRows () * MASK_WORDS_PER_ROW (igrid_GetNumCols ());
+  *the_union = 0;
+  *intersection = 0;
+  for (i = 0; i < words; i++)
+  {
+    *the_union += util_popcount64 (mask1[i] | mask2[i]);
+    *intersection += util_popcount64 (mask1[i] & mask2[i]);
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_mask_edges
+** PURPOSE:       count the set pixels and the edge pixels of a bit mask
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Bit mask form of stats_edge: an edge pixel is set and
+**                has an unset N, S, E or W neighbor on the image. Works
+**                on the complement, so neighbors off the image never
+**                make an edge.
+**
+*/
+void
+  util_mask_edges (MASK_WORD * mask,                         /* IN     */
+                   int *area,                                /* OUT    */
+                   int *edges)                               /* OUT    */
+{
+  int nrows;
+  int ncols;
+  int wpr;
+  int row;
+  int k;
+  MASK_WORD tail;
+  MASK_WORD *up;
+  MASK_WORD *mid;
+  MASK_WORD *down;
+  MASK_WORD open;
+
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  wpr = MASK_WORDS_PER_ROW (ncols);
+  tail = (ncols % 64) ? ((MASK_WORD) 1 << (ncols % 64)) - 1 : ~(MASK_WORD) 0;
+  *area = 0;
+  *edges = 0;
+  for (row = 0; row < nrows; row++)
+  {
+    up = (row > 0) ? mask + (row - 1) * wpr : NULL;
+    mid = mask + row * wpr;
+    down = (row < nrows - 1) ? mask + (row + 1) * wpr : NULL;
+    for (k = 0; k < wpr; k++)
+    {
+      open = util_mask_word (up, k, wpr, tail, 0, 1) |
+        util_mask_word (down, k, wpr, tail, 0, 1) |
+        util_mask_word (mid, k, wpr, tail, -1, 1) |
+        util_mask_word (mid, k, wpr, tail, 1, 1);
+      *area += util_popcount64 (mid[k]);
+      *edges += util_popcount64 (mid[k] & open);
+    }
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_mask_spreading
+** PURPOSE:       mark the pixels with two to seven set neighbors
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Sets the bits of out whose 8-neighbor count in mask is
+**                at least 2 but not 8, the organic growth rule of
+**                spr_phase4, 64 pixels at a time. Neighbors off the
+**                image count as unset.
+**
+*/
+void
+  util_mask_spreading (MASK_WORD * mask,                     /* IN     */
+                       MASK_WORD * out)                      /* OUT    */
+{
+  int nrows;
+  int ncols;
+  int wpr;
+  int row;
+  int k;
+  int n;
+  MASK_WORD tail;
+  MASK_WORD *up;
+  MASK_WORD *mid;
+  MASK_WORD *down;
+  MASK_WORD nbr[8];
+  MASK_WORD ones;
+  MASK_WORD twos;
+  MASK_WORD eights;
+
+  nrows = igrid_GetNumRows ();
+  ncols = igrid_GetNumCols ();
+  wpr = MASK_WORDS_PER_ROW (ncols);
+  tail = (ncols % 64) ? ((MASK_WORD) 1 << (ncols % 64)) - 1 : ~(MASK_WORD) 0;
+  for (row = 0; row < nrows; row++)
+  {
+    up = (row > 0) ? mask + (row - 1) * wpr : NULL;
+    mid = mask + row * wpr;
+    down = (row < nrows - 1) ? mask + (row + 1) * wpr : NULL;
+    for (k = 0; k < wpr; k++)
+    {
+      nbr[0] = util_mask_word (up, k, wpr, tail, -1, 0);
+      nbr[1] = util_mask_word (up, k, wpr, tail, 0, 0);
+      nbr[2] = util_mask_word (up, k, wpr, tail, 1, 0);
+      nbr[3] = util_mask_word (mid, k, wpr, tail, -1, 0);
+      nbr[4] = util_mask_word (mid, k, wpr, tail, 1, 0);
+      nbr[5] = util_mask_word (down, k, wpr, tail, -1, 0);
+      nbr[6] = util_mask_word (down, k, wpr, tail, 0, 0);
+      nbr[7] = util_mask_word (down, k, wpr, tail, 1, 0);
+      ones = 0;
+      twos = 0;
+      eights = ~(MASK_WORD) 0;
+      for (n = 0; n < 8; n++)
+      {
+        twos |= ones & nbr[n];
+        ones |= nbr[n];
+        eights &= nbr[n];
+      }
+      out[row * wpr + k] =
+        twos & ~eights & ((k == wpr - 1) ? tail : ~(MASK_WORD) 0);
+    }
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_lane_count_add
+** PURPOSE:       add one to the lane counts of the set bits of a word
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   A ripple carry add of word into the LANE_PLANES
+**                planes; every replica of a batch is counted at once
+**                and the carry rarely goes past the first planes.
+**
+*/
+void
+  util_lane_count_add (MASK_WORD * planes,                   /* IN/OUT */
+                       MASK_WORD word)                       /* IN     */
+{
+  MASK_WORD carry;
+  int p;
+
+  for (p = 0; word != 0; p++)
+  {
+    carry = planes[p] & word;
+    planes[p] ^= word;
+    word = carry;
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_lane_counts
+** PURPOSE:       read the counts of the first nlanes lanes
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  util_lane_counts (MASK_WORD * planes,                      /* IN     */
+                    int nlanes,                              /* IN     */
+                    int *counts)                             /* OUT    */
+{
+  int k;
+  int p;
+
+  for (k = 0; k < nlanes; k++)
+  {
+    counts[k] = 0;
+    for (p = 0; p < LANE_PLANES - 1; p++)
+    {
+      counts[k] |= (int) ((planes[p] >> k) & 1) << p;
+    }
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_OpenDeferred
+** PURPOSE:       return a temporary file to hold back output in
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Opens one on the first call and returns deferred on
+**                the later ones; util_FlushDeferred empties it.
+**
+*/
+FILE *
+  util_OpenDeferred (FILE * deferred)                        /* IN     */
+{
+  char func[] = "util_OpenDeferred";
+
+  if (deferred == NULL)
+  {
+    deferred = tmpfile ();
+    if (deferred == NULL)
+    {
+      sprintf (msg_buf, "Unable to open a temporary file: %s",
+               strerror (errno));
+      LOG_ERROR (msg_buf);
+      EXIT (1);
+    }
+  }
+  return deferred;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_FlushDeferred
+** PURPOSE:       copy the output held back in deferred to fp
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Copies what was written to deferred since it was
+**                opened or last flushed, and rewinds it for reuse.
+**
+*/
+void
+  util_FlushDeferred (FILE * deferred,                       /* IN/OUT */
+                      FILE * fp)                             /* IN/OUT */
+{
+  char buf[4096];
+  long length;
+  size_t n;
+
+  length = ftell (deferred);
+  rewind (deferred);
+  while (length > 0)
+  {
+    n = fread (buf, 1, MIN (length, (long) sizeof (buf)), deferred);
+    if (n == 0)
+    {
+      break;
+    }
+    fwrite (buf, 1, n, fp);
+    length -= n;
+  }
+  rewind (deferred);
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_CountGridAlloc
+** PURPOSE:       allocate a zeroed count grid of num_counts counts
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   The counts are 16 bits if max_count fits, else 32.
+**                The memory module allocates them and keeps their bytes
+**                in its accounting (see mem_CountGridAlloc).
+**
+*/
+void
+  util_CountGridAlloc (count_grid_t * grid,                  /* OUT    */
+                       int max_count,                        /* IN     */
+                       size_t num_counts)                    /* IN     */
+{
+  grid->c16 = NULL;
+  grid->c32 = NULL;
+  if (max_count <= USHRT_MAX)
+  {
+    grid->num_bytes = num_counts * sizeof (unsigned short);
+    grid->c16 = (unsigned short *) mem_CountGridAlloc (grid->num_bytes);
+  }
+  else
+  {
+    grid->num_bytes = num_counts * sizeof (unsigned int);
+    grid->c32 = (unsigned int *) mem_CountGridAlloc (grid->num_bytes);
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_CountGridFree
+** PURPOSE:       free a count grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:
+**
+**
+*/
+void
+  util_CountGridFree (count_grid_t * grid)                   /* IN/OUT */
+{
+  if (grid->c16 != NULL)
+  {
+    mem_CountGridFree (grid->c16, grid->num_bytes);
+  }
+  if (grid->c32 != NULL)
+  {
+    mem_CountGridFree (grid->c32, grid->num_bytes);
+  }
+  grid->c16 = NULL;
+  grid->c32 = NULL;
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_CountUrban
+** PURPOSE:       count the urban pixels of z
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   Adds one to the count at offset + i for each z[i] > 0,
+**                visiting only the active domain when there is one
+**                (ACTIVE_DOMAIN). Over the whole grid the add has no
+**                branch, so the compiler can vectorize the loop.
+**
+*/
+void
+  util_CountUrban (count_grid_t * grid,                      /* IN/OUT */
+                   size_t offset,                            /* IN     */
+                   GRID_P z,                                 /* IN     */
+                   int *active,                              /* IN     */
+                   int ncells)                               /* IN     */
+{
+  unsigned short *c16;
+  unsigned int *c32;
+  int i;
+  int k;
+
+  if (grid->c16 != NULL)
+  {
+    c16 = grid->c16 + offset;
+    if (active == NULL)
+    {
+      for (i = 0; i < ncells; i++)
+      {
+        c16[i] += (z[i] > 0);
+      }
+      return;
+    }
+    for (k = 0; k < ncells; k++)
+    {
+      i = active[k];
+      c16[i] += (z[i] > 0);
+    }
+    return;
+  }
+  c32 = grid->c32 + offset;
+  if (active == NULL)
+  {
+    for (i = 0; i < ncells; i++)
+    {
+      c32[i] += (z[i] > 0);
+    }
+    return;
+  }
+  for (k = 0; k < ncells; k++)
+  {
+    i = active[k];
+    c32[i] += (z[i] > 0);
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_CountClasses
+** PURPOSE:       count the land class of each pixel
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   The grid holds a count grid per class index; adds one
+**                to pixel i of the grid of class new_indices[land[i]],
+**                in one pass over land. A pixel of no class below
+**                num_classes is not counted.
+**
+*/
+void
+  util_CountClasses (count_grid_t * grid,                    /* IN/OUT */
+                     GRID_P land,                            /* IN     */
+                     int *new_indices,                       /* IN     */
+                     int num_classes,                        /* IN     */
+                     int num_pixels)                         /* IN     */
+{
+  int cc;
+  int i;
+
+  for (i = 0; i < num_pixels; i++)
+  {
+    cc = new_indices[land[i]];
+    if ((cc < 0) || (cc >= num_classes))
+    {
+      continue;
+    }
+    if (grid->c16 != NULL)
+    {
+      grid->c16[(size_t) cc * num_pixels + i]++;
+    }
+    else
+    {
+      grid->c32[(size_t) cc * num_pixels + i]++;
+    }
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_CountPercent
+** PURPOSE:       write counts as a percent of num to a grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   out[i] = 100 * count / num, for the counts at offset.
+**
+*/
+void
+  util_CountPercent (count_grid_t * grid,                    /* IN     */
+                     size_t offset,                          /* IN     */
+                     int num,                                /* IN     */
+                     GRID_P out,                             /* OUT    */
+                     int num_pixels)                         /* IN     */
+{
+  unsigned short *c16;
+  unsigned int *c32;
+  int i;
+
+  assert (num > 0);
+  if (grid->c16 != NULL)
+  {
+    c16 = grid->c16 + offset;
+    for (i = 0; i < num_pixels; i++)
+    {
+      out[i] = (100 * (unsigned int) c16[i]) / num;
+    }
+    return;
+  }
+  c32 = grid->c32 + offset;
+  for (i = 0; i < num_pixels; i++)
+  {
+    out[i] = (100 * (double) c32[i]) / num;
+  }
+}
+
+/******************************************************************************
+*******************************************************************************
+** FUNCTION NAME: util_CountCopy
+** PURPOSE:       write counts to a grid
+** AUTHOR:        SLEUTH-3r maintainers
+** PROGRAMMER:    SLEUTH-3r maintainers
+** CREATION DATE: 10/17/2026
+** DESCRIPTION:   out[i] = count, for the counts at offset; a count
+**                over 255 is written as 255.
+**
+*/
+void
+  util_CountCopy (count_grid_t * grid,                       /* IN     */
+                  size_t offset,                             /* IN     */
+                  GRID_P out,                                /* OUT    */
+                  int num_pixels)                            /* IN     */
+{
+  unsigned int count;
+  int i;
+
+  for (i = 0; i < num_pixels; i++)
+  {
+    count = COUNT_AT (grid, offset + i);
+    out[i] = MIN (count, 255);
+  }
+}
+
 /******************************************************************************
 *******************************************************************************
 ** FUNCTION NAME: util_get_next_neighbor
@@ -600,6 +1355,9 @@ void
   char func[] = "util_get_next_neighbor";
 
   static int last_index;
+#ifdef _OPENMP
+#pragma omp threadprivate (last_index)
+#endif
   int i_adj;
   int j_adj;
   int row[8] = {-1, 0, 1, 1, 1, 0, -1, -1};
@@ -9,6 +9,49 @@ char utilities_h_sccs_id[] = "@(#)utilities.h	1.258	12/4/00";
 
 #endif
 
+/*
+ *
+ * BIT MASKS: one bit per pixel, bit (j % 64) of word j / 64 of the
+ * row; bits past the last column are always 0
+ *
+ */
+#define MASK_WORDS_PER_ROW(ncols)  (((ncols) + 63) / 64)
+#define MASK_TEST(mask,wpr,i,j)                                           \
+        (((mask)[(i) * (wpr) + ((j) >> 6)] >> ((j) & 63)) & 1)
+#define MASK_SET(mask,wpr,i,j)                                            \
+        ((mask)[(i) * (wpr) + ((j) >> 6)] |= (MASK_WORD) 1 << ((j) & 63))
+#define MASK_CLEAR(mask,wpr,i,j)                                          \
+        ((mask)[(i) * (wpr) + ((j) >> 6)] &= ~((MASK_WORD) 1 << ((j) & 63)))
+
+/*
+ *
+ * REPLICA WORDS (BIT_SLICED_REPLICAS): one MASK_WORD per pixel, bit k
+ * for replica k of a batch. A lane counter is LANE_PLANES words, bit
+ * k of word p being bit p of replica k's count.
+ *
+ */
+#define REPLICA_LANES 64
+#define LANE_PLANES   32
+#define LANE_BIT(k)   ((MASK_WORD) 1 << (k))
+
+/*
+ *
+ * COUNT GRIDS: Monte Carlo counts, c16 when the iterations fit in 16
+ * bits and c32 when they do not; the other pointer is NULL (see
+ * util_CountGridAlloc). num_bytes is what the memory module counted for
+ * the grid.
+ *
+ */
+typedef struct
+{
+  unsigned short *c16;
+  unsigned int *c32;
+  size_t num_bytes;
+} count_grid_t;
+#define COUNT_AT(grid,i)                                                  \
+        (((grid)->c16 != NULL) ? (unsigned int) (grid)->c16[i]            \
+                               : (grid)->c32[i])
+
 
 /*
  *
@@ -54,6 +97,72 @@ int util_count_neighbors(GRID_P grid,   /* IN     */
                          int option,     /* IN     */
                          PIXEL value);   /* IN     */
 
+void util_increment_neighbors(GRID_P count, /* IN/OUT */
+                              int i,        /* IN     */
+                              int j);       /* IN     */
+
+void util_clear_neighbors(GRID_P count,     /* IN/OUT */
+                          int i,            /* IN     */
+                          int j);           /* IN     */
+
+void util_mask_from_grid(GRID_P grid,         /* IN     */
+                         MASK_WORD* mask);    /* OUT    */
+
+int util_mask_popcount(MASK_WORD* mask);      /* IN     */
+
+void util_mask_union_intersection(MASK_WORD* mask1,     /* IN     */
+                                  MASK_WORD* mask2,     /* IN     */
+                                  int* the_union,       /* OUT    */
+                                  int* intersection);   /* OUT    */
+
+void util_mask_edges(MASK_WORD* mask,         /* IN     */
+                     int* area,               /* OUT    */
+                     int* edges);             /* OUT    */
+
+void util_mask_spreading(MASK_WORD* mask,     /* IN     */
+                         MASK_WORD* out);     /* OUT    */
+
+void util_lane_count_add(MASK_WORD* planes,   /* IN/OUT */
+                         MASK_WORD word);     /* IN     */
+
+void util_lane_counts(MASK_WORD* planes,      /* IN     */
+                      int nlanes,             /* IN     */
+                      int* counts);           /* OUT    */
+
+FILE* util_OpenDeferred(FILE* deferred);      /* IN     */
+
+void util_FlushDeferred(FILE* deferred,       /* IN/OUT */
+                        FILE* fp);            /* IN/OUT */
+
+void util_CountGridAlloc(count_grid_t* grid,  /* OUT    */
+                         int max_count,       /* IN     */
+                         size_t num_counts);  /* IN     */
+
+void util_CountGridFree(count_grid_t* grid);  /* IN/OUT */
+
+void util_CountUrban(count_grid_t* grid,      /* IN/OUT */
+                     size_t offset,           /* IN     */
+                     GRID_P z,                /* IN     */
+                     int* active,             /* IN     */
+                     int ncells);             /* IN     */
+
+void util_CountClasses(count_grid_t* grid,    /* IN/OUT */
+                       GRID_P land,           /* IN     */
+                       int* new_indices,      /* IN     */
+                       int num_classes,       /* IN     */
+                       int num_pixels);       /* IN     */
+
+void util_CountPercent(count_grid_t* grid,    /* IN     */
+                       size_t offset,         /* IN     */
+                       int num,               /* IN     */
+                       GRID_P out,            /* OUT    */
+                       int num_pixels);       /* IN     */
+
+void util_CountCopy(count_grid_t* grid,       /* IN     */
+                    size_t offset,            /* IN     */
+                    GRID_P out,               /* OUT    */
+                    int num_pixels);          /* IN     */
+
 void util_get_next_neighbor(int i_in,      /* IN     */
                             int j_in,      /* IN     */
                             int* i_out,    /* OUT    */